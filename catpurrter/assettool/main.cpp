@@ -0,0 +1,146 @@
+#include <SFML/Graphics.hpp>
+#include "AtlasPacker.h"
+#include "AssetPack.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <set>
+#include <string>
+
+// assettool bakes game assets ahead of time so the game doesn't have to at startup.
+// Run from the catpurrter project directory (the one containing assets/):
+//   assettool atlas          bakes every atlas into assets/atlas
+//   assettool atlas <name>   bakes one atlas ("room", "closeup" or "aquarium")
+//   assettool pack [--png]   writes assets/assets.pak (images stored as RGBA unless --png)
+//   assettool verify         lists assets changed, added or removed since the pack was built
+
+// Packs one atlas from the manifest and writes it to assets/atlas. Returns false on any failure.
+static bool bakeAtlas(const std::string& name) {
+    AtlasPacker packer;
+    size_t missing = 0;
+    for (const AtlasSource& source : AtlasPacker::manifest(name)) {
+        if (!packer.addFile(source))
+            missing++;
+    }
+    if (missing > 0) {
+        std::cout << "Atlas " << name << ": " << missing << " sprite(s) missing, not writing it\n";
+        return false;
+    }
+    if (!packer.pack() || !packer.save("assets/atlas", name))
+        return false;
+
+    std::cout << "Atlas " << name << ": " << packer.getRegions().size() << " sprites on "
+        << packer.getPages().size() << " page(s)\n";
+    return true;
+}
+
+// Returns the files that go into the pack: graphics, baked atlases and fonts, sorted.
+static std::vector<std::string> packFiles() {
+    // Sprites that already live in a baked atlas page don't need their own entry
+    std::set<std::string> inAtlas;
+    for (const std::string& name : AtlasPacker::atlasNames()) {
+        if (!std::filesystem::exists("assets/atlas/" + name + ".json"))
+            continue;
+        for (const AtlasSource& source : AtlasPacker::manifest(name))
+            inAtlas.insert(source.path);
+    }
+
+    std::vector<std::string> files;
+    for (const std::string dir : { "assets/graphics", "assets/atlas", "assets/fonts" }) {
+        if (!std::filesystem::exists(dir))
+            continue;
+        for (const auto& item : std::filesystem::recursive_directory_iterator(dir)) {
+            if (!item.is_regular_file())
+                continue;
+            std::string path = item.path().generic_string();
+            if (!inAtlas.count(path))
+                files.push_back(path);
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+// Packs graphics, baked atlases and fonts into assets/assets.pak. Returns false on any failure.
+static bool buildPack(bool storeRgba) {
+    const std::vector<std::string> files = packFiles();
+    if (!AssetPack::build("assets/assets.pak", files, storeRgba))
+        return false;
+    std::cout << "Pack: " << files.size() << " files written to assets/assets.pak"
+        << (storeRgba ? " (images as RGBA)" : "") << "\n";
+    return true;
+}
+
+// Compares assets/assets.pak with the loose files. Returns false if the pack is missing, damaged or stale.
+static bool verifyPack() {
+    const AssetPack& pack = AssetPack::instance();
+    if (!pack.isOpen())
+        return false;
+
+    std::size_t problems = 0;
+    std::uint32_t matched = 0;
+    for (const std::string& path : packFiles()) {
+        const AssetPack::Entry* entry = pack.find(path);
+        if (!entry) {
+            std::cout << "Not in pack: " << path << "\n";
+            problems++;
+            continue;
+        }
+        matched++;
+        if (!pack.isIntact(*entry)) {
+            std::cout << "Damaged: " << path << "\n";
+            problems++;
+        }
+        else if (!AssetPack::matchesSource(*entry, path)) {
+            std::cout << "Changed since packed: " << path << "\n";
+            problems++;
+        }
+    }
+    if (matched < pack.getEntryCount()) {
+        std::cout << "Removed since packed: " << pack.getEntryCount() - matched << " file(s)\n";
+        problems++;
+    }
+
+    if (problems > 0) {
+        std::cout << "Pack is out of date, run assettool pack\n";
+        return false;
+    }
+    std::cout << "Pack: " << matched << " files up to date\n";
+    return true;
+}
+
+static void printUsage() {
+    std::cout << "usage: assettool atlas [name]\n"
+        << "       assettool pack [--png]\n"
+        << "       assettool verify\n";
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+
+    std::string command = argv[1];
+    if (command == "atlas") {
+        bool ok = true;
+        if (argc >= 3) {
+            ok = bakeAtlas(argv[2]);
+        }
+        else {
+            for (const std::string& name : AtlasPacker::atlasNames())
+                ok = bakeAtlas(name) && ok;
+        }
+        return ok ? 0 : 1;
+    }
+    if (command == "pack") {
+        bool storeRgba = !(argc >= 3 && std::string(argv[2]) == "--png");
+        return buildPack(storeRgba) ? 0 : 1;
+    }
+    if (command == "verify")
+        return verifyPack() ? 0 : 1;
+
+    printUsage();
+    return 1;
+}
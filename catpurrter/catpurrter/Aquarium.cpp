@@ -1,4 +1,6 @@
 #include "Aquarium.h"
+#include "AssetCache.h"
+#include "Interpolation.h"
 #include <iostream>
 #include <random>
 
@@ -11,24 +13,44 @@ const float FISH_WIDTH = 100.f;
 const float FISH_HEIGHT = 64.f;
 
 Aquarium::Aquarium(sf::Font& fontRef, Player& playerRef)
-    : font(fontRef), playerData(playerRef), closeRequested(false) {
+    : font(fontRef), playerData(playerRef) {
 }
 
-void Aquarium::init() {
-    closeRequested = false;
+AssetList Aquarium::requiredAssets(const Player&) {
+    return { {}, { "closeup", "aquarium" } };
+}
+
+std::vector<std::string> Aquarium::ownedDecorations(const Player& player) {
+    // Drawing order: castle goes over the plants
+    const std::vector<std::string> catalog = { "plant", "castle" };
+    std::vector<std::string> owned;
+    for (const auto& id : catalog) {
+        if (std::find(player.aquariumContents.begin(), player.aquariumContents.end(), id) != player.aquariumContents.end())
+            owned.push_back(id);
+    }
+    return owned;
+}
 
-    aquariumBigTexture.loadFromFile("assets/graphics/aquarium/aquariumbig.png");
-    aquariumBigPlants.loadFromFile("assets/graphics/aquarium/aquariumplantsbig.png");
-    aquariumBigCastle.loadFromFile("assets/graphics/aquarium/aquariumcastlebig.png");
-    aquariumBigAll.loadFromFile("assets/graphics/aquarium/aquariumallbig.png");
+void Aquarium::init() {
+    AssetCache& assets = AssetCache::instance();
+    // Decorations can't change while the view is up; onEnter() rebuilds it if they did while it was suspended
+    builtVersion = playerData.inventoryVersion;
+    tankAtlas = assets.getAtlas("aquarium");
+    tank.clear();
+    if (tankAtlas) {
+        std::vector<std::string> layers;
+        for (const auto& id : ownedDecorations(playerData))
+            layers.push_back("aquariumbig_" + id);
+        tank.build(*tankAtlas, "aquariumbig", layers);
+    }
 
+    atlas = assets.getAtlas("closeup");
+    fishTextures.clear();
     std::vector<std::string> fishIds = { "fish1", "fish2", "fish3" };
     for (const auto& id : fishIds) {
-        sf::Texture texRight, texLeft;
-        texRight.loadFromFile("assets/graphics/aquarium/" + id + "rightbig.png");
-        texLeft.loadFromFile("assets/graphics/aquarium/" + id + "leftbig.png");
-        fishTextures[id + "rightbig"] = std::move(texRight);
-        fishTextures[id + "leftbig"] = std::move(texLeft);
+        if (!atlas) break;
+        if (const AtlasSprite* sprite = atlas->find(id + "big"))
+            fishTextures[id] = *sprite;
     }
 
     fishes.clear();
@@ -43,6 +65,7 @@ void Aquarium::init() {
             fish.id = id;
             fish.facingRight = (gen() % 2 == 0);
             fish.position = sf::Vector2f(xDist(gen), yDist(gen));
+            fish.previous = fish.position;
             float vx = (fish.facingRight ? 1.0f : -1.0f) * (25.f + float(gen() % 20));
             float vy = (gen() % 2 ? 1.0f : -1.0f) * (15.f + float(gen() % 10));
             fish.velocity = { vx, vy };
@@ -56,14 +79,14 @@ void Aquarium::init() {
 
 void Aquarium::update(float dt) {
     for (auto& fish : fishes) {
-        std::string texKey = fish.id + (fish.facingRight ? "rightbig" : "leftbig");
-        auto it = fishTextures.find(texKey);
+        auto it = fishTextures.find(fish.id);
         float fishWidth = 100.f, fishHeight = 64.f;
         if (it != fishTextures.end()) {
-            fishWidth = static_cast<float>(it->second.getSize().x);
-            fishHeight = static_cast<float>(it->second.getSize().y);
+            fishWidth = static_cast<float>(it->second.rect.width);
+            fishHeight = static_cast<float>(it->second.rect.height);
         }
 
+        fish.previous = fish.position;
         fish.position += fish.velocity * dt;
         fish.distanceSinceDirectionChange += std::abs(fish.velocity.x * dt) + std::abs(fish.velocity.y * dt);
 
@@ -111,42 +134,24 @@ void Aquarium::update(float dt) {
     }
 }
 
-void Aquarium::render(sf::RenderWindow& window) {
-    bool hasPlant = false, hasCastle = false;
-    for (const auto& item : playerData.aquariumContents) {
-        if (item == "plant") hasPlant = true;
-        if (item == "castle") hasCastle = true;
-    }
-
-    sf::Sprite bgSprite;
-    if (hasPlant && hasCastle)
-        bgSprite.setTexture(aquariumBigAll);
-    else if (hasPlant)
-        bgSprite.setTexture(aquariumBigPlants);
-    else if (hasCastle)
-        bgSprite.setTexture(aquariumBigCastle);
-    else
-        bgSprite.setTexture(aquariumBigTexture);
-    bgSprite.setPosition(0, 0);
-    window.draw(bgSprite);
+void Aquarium::render(DrawList& target, float alpha) {
+    tank.appendTo(target);
 
     for (const auto& fish : fishes) {
-        std::string texKey = fish.id + (fish.facingRight ? "rightbig" : "leftbig");
-        auto it = fishTextures.find(texKey);
+        auto it = fishTextures.find(fish.id);
         if (it != fishTextures.end()) {
             sf::Sprite fishSprite;
-            fishSprite.setTexture(it->second);
-            sf::Vector2u texSize = it->second.getSize();
-            fishSprite.setOrigin(texSize.x / 2.f, texSize.y / 2.f);
-            fishSprite.setPosition(fish.position);
-            window.draw(fishSprite);
+            fishSprite.setTexture(*it->second.texture);
+            fishSprite.setTextureRect(it->second.textureRect(!fish.facingRight));
+            fishSprite.setOrigin(it->second.rect.width / 2.f, it->second.rect.height / 2.f);
+            fishSprite.setPosition(lerp(fish.previous, fish.position, alpha));
+            target.draw(fishSprite);
         }
     }
+}
 
-    sf::Text title;
-    title.setFont(font);
-    title.setString("Aquarium View");
-    title.setCharacterSize(30);
+void Aquarium::renderUi(DrawList& window) {
+    sf::Text& title = texts.get("Aquarium View", font, 30);
     title.setFillColor(sf::Color::Cyan);
     title.setPosition(100.f, 30.f);
     window.draw(title);
@@ -154,14 +159,11 @@ void Aquarium::render(sf::RenderWindow& window) {
 
 void Aquarium::handleInput(sf::Keyboard::Key key) {
     if (key == sf::Keyboard::Escape) {
-        closeRequested = true;
+        requestClose();
     }
 }
 
-bool Aquarium::shouldClose() const {
-    return closeRequested;
-}
-
-void Aquarium::resetCloseFlag() {
-    closeRequested = false;
+void Aquarium::onEnter() {
+    if (builtVersion != playerData.inventoryVersion)
+        init();
 }
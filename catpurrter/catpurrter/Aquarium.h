@@ -1,6 +1,13 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "DrawList.h"
 #include "Player.h"
+#include "AssetCache.h"
+#include "SpriteAtlas.h"
+#include "LayeredSprite.h"
+#include "TextCache.h"
+#include "Scene.h"
+#include <memory>
 #include <unordered_map>
 #include <vector>
 #include <string>
@@ -8,7 +15,7 @@
 // Aquarium represents the fullscreen view of the player's aquarium.
 // It animates fish and decorations the player has purchased and placed in the aquarium.
 // Handles input, fish animation logic, and rendering the aquarium scene.
-class Aquarium {
+class Aquarium : public Scene {
 public:
     // Constructs an Aquarium view with references to the game's font and the Player data.
     Aquarium(sf::Font& font, Player& player);
@@ -16,38 +23,43 @@ public:
     // Initializes aquarium state (loads textures, positions fish, etc).
     void init();
 
+    // Returns the textures and atlases init() uses, so they can be prefetched before the view opens.
+    static AssetList requiredAssets(const Player& player);
+
+    // Returns the tank decorations the player owns, in drawing order (ids like "plant", see AtlasPacker::manifest).
+    static std::vector<std::string> ownedDecorations(const Player& player);
+
     // Updates fish animations and any other aquarium logic.
-    // dt: time elapsed since last frame (seconds).
+    // dt: length of one simulation step (seconds).
     void update(float dt);
 
-    // Draws the aquarium, all fish, and decorations to the window.
-    void render(sf::RenderWindow& window);
+    // Draws the tank with its decorations and the fish (the world pass, may be drawn at reduced resolution).
+    // alpha: how far (0-1) the frame lies between the last two steps; fish are drawn in between.
+    void render(DrawList& target, float alpha);
+
+    // Draws the view title on top at native resolution.
+    void renderUi(DrawList& target);
 
     // Handles keyboard input. ESC closes the aquarium view.
     void handleInput(sf::Keyboard::Key key);
 
-    // Returns true if the player has requested to close the aquarium view.
-    bool shouldClose() const;
-
-    // Resets the close flag so the view won't immediately close next time it's opened.
-    void resetCloseFlag();
+    // Rebuilds the view if the player's decorations or fish changed while it was suspended.
+    void onEnter() override;
 
 private:
     sf::Font& font;        // Reference to game font for rendering text.
+    TextCache texts;       // The view title, laid out once.
     Player& playerData;    // Reference to player data (to access owned fish/decorations).
-    bool closeRequested;   // True if the player pressed ESC to exit aquarium.
 
-    // Background aquarium images for different decoration combinations:
-    sf::Texture aquariumBigTexture;    // Base aquarium image (no decorations).
-    sf::Texture aquariumBigPlants;     // With plants decoration.
-    sf::Texture aquariumBigCastle;     // With castle decoration.
-    sf::Texture aquariumBigAll;        // With both plants and castle.
+    std::shared_ptr<SpriteAtlas> tankAtlas; // Aquarium atlas: the empty tank and one layer per decoration.
+    LayeredSprite tank;                     // Tank with the owned decoration layers, drawn in one pass.
 
     // FishVisual represents one animated fish in the aquarium.
     struct FishVisual {
         std::string id;                  // Fish type identifier (e.g., "fish1")
         bool facingRight = true;         // True if fish is facing right.
         sf::Vector2f position;           // Current position of the fish.
+        sf::Vector2f previous;           // Position after the previous step.
         sf::Vector2f velocity;           // Current velocity (pixels/sec).
         float directionTimer = 0;        // Timer until next random direction change.
         float distanceSinceDirectionChange = 0.0f; // How far since last change.
@@ -55,5 +67,7 @@ private:
     };
 
     std::vector<FishVisual> fishes;                    // All fish currently swimming.
-    std::unordered_map<std::string, sf::Texture> fishTextures; // Fish textures (by id + direction).
+    std::shared_ptr<SpriteAtlas> atlas;    // Close-up atlas holding the big fish.
+    unsigned builtVersion = 0;             // Player::inventoryVersion init() built the view for.
+    std::unordered_map<std::string, AtlasSprite> fishTextures; // Right-facing fish sprites in the atlas (by fish id).
 };
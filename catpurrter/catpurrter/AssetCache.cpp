@@ -0,0 +1,493 @@
+#include "AssetCache.h"
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include "AtlasPacker.h"
+#include "SpriteAtlas.h"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace {
+    std::size_t textureBytes(const sf::Texture& tex) {
+        return static_cast<std::size_t>(tex.getSize().x) * tex.getSize().y * 4;
+    }
+
+    // Rows uploaded per texture update; 64 rows of an 800px image is ~200 KB.
+    const unsigned UPLOAD_STRIPE_ROWS = 64;
+}
+
+AssetCache::AssetCache() = default;
+
+AssetCache::~AssetCache() = default;
+
+AssetCache& AssetCache::instance() {
+    static AssetCache cache;
+    return cache;
+}
+
+std::shared_ptr<sf::Texture> AssetCache::getTexture(const std::string& path) {
+    auto it = textures.find(path);
+    if (it != textures.end()) {
+        stats.hits++;
+        touchTexture(path, true);
+        return it->second;
+    }
+
+    // Needed right now: a prefetch still in flight is finished in one go instead of sliced
+    std::unique_ptr<sf::Image> image;
+    auto pending = std::find_if(uploads.begin(), uploads.end(),
+        [&](const PendingUpload& upload) { return upload.path == path; });
+    if (pending != uploads.end()) {
+        image = std::move(pending->image);
+        uploads.erase(pending);
+    }
+    if (!image)
+        image = getLoader().take(path);
+
+    stats.misses++;
+    std::shared_ptr<sf::Texture> tex;
+    if (image) {
+        tex = std::make_shared<sf::Texture>();
+        if (!tex->loadFromImage(*image))
+            tex = nullptr;
+    }
+    if (!tex) {
+        std::cout << "Failed to load texture: " << path << "\n";
+        stats.failures++;
+    }
+    else {
+        stats.bytesLoaded += textureBytes(*tex);
+    }
+    textures[path] = tex;
+    touchTexture(path, true);
+    return tex;
+}
+
+AssetLoader& AssetCache::getLoader() {
+    if (!loader)
+        loader = std::make_unique<AssetLoader>();
+    return *loader;
+}
+
+void AssetCache::prefetch(const AssetList& assets) {
+    for (const auto& path : assets.textures)
+        prefetchTexture(path);
+    for (const auto& name : assets.atlases)
+        prefetchAtlas(name);
+}
+
+void AssetCache::prefetchTexture(const std::string& path) {
+    if (textures.count(path))
+        return;
+    for (const auto& upload : uploads) {
+        if (upload.path == path)
+            return;
+    }
+    getLoader().request(path);
+    PendingUpload upload;
+    upload.path = path;
+    uploads.push_back(std::move(upload));
+}
+
+void AssetCache::prefetchAtlas(const std::string& name) {
+    if (atlases.count(name) || pendingAtlases.count(name))
+        return;
+
+    PendingAtlas pending;
+    pending.files = SpriteAtlas::bakedPagePaths(name);
+    pending.baked = !pending.files.empty();
+    if (pending.baked) {
+        for (const auto& page : pending.files)
+            prefetchTexture(page);
+    }
+    else {
+        // Not baked: decode the loose sprites now, the atlas is packed once they're all in
+        for (const AtlasSource& source : AtlasPacker::manifest(name)) {
+            getLoader().request(source.path);
+            pending.files.push_back(source.path);
+        }
+    }
+    pendingAtlases[name] = std::move(pending);
+}
+
+void AssetCache::cancelPrefetch(const AssetList& assets) {
+    auto cancelTexture = [this](const std::string& path) {
+        auto it = std::find_if(uploads.begin(), uploads.end(),
+            [&](const PendingUpload& upload) { return upload.path == path; });
+        // Half-uploaded textures are finished; throwing them away would waste the work already done
+        if (it != uploads.end() && !it->texture) {
+            uploads.erase(it);
+            getLoader().cancel(path);
+        }
+    };
+
+    for (const auto& path : assets.textures)
+        cancelTexture(path);
+    for (const auto& name : assets.atlases) {
+        auto it = pendingAtlases.find(name);
+        if (it == pendingAtlases.end())
+            continue;
+        for (const auto& file : it->second.files) {
+            if (it->second.baked)
+                cancelTexture(file);
+            else
+                getLoader().cancel(file);
+        }
+        pendingAtlases.erase(it);
+    }
+}
+
+void AssetCache::evict(const AssetList& assets) {
+    for (const auto& path : assets.textures) {
+        auto it = textures.find(path);
+        if (it != textures.end() && it->second && it->second.use_count() == 1) {
+            fenceRelease();
+            residency.erase(path);
+            textures.erase(it);
+        }
+    }
+    for (const auto& name : assets.atlases) {
+        auto it = atlases.find(name);
+        if (it != atlases.end() && it->second && it->second.use_count() == 1)
+            dropAtlas(it);
+    }
+}
+
+void AssetCache::fenceRelease() const {
+    if (releaseFence)
+        releaseFence();
+}
+
+void AssetCache::dropAtlas(std::unordered_map<std::string, std::shared_ptr<SpriteAtlas>>::iterator it) {
+    fenceRelease();
+    std::vector<std::shared_ptr<sf::Texture>> pages;
+    if (it->second)
+        pages = it->second->getPages();
+    atlasLastUse.erase(it->first);
+    atlases.erase(it);
+    // Pages are now held only by the cache and the local copy
+    for (auto tex = textures.begin(); tex != textures.end();) {
+        bool isPage = std::find(pages.begin(), pages.end(), tex->second) != pages.end();
+        if (isPage && tex->second.use_count() == 2) {
+            residency.erase(tex->first);
+            tex = textures.erase(tex);
+        }
+        else {
+            ++tex;
+        }
+    }
+}
+
+bool AssetCache::uploadRows(PendingUpload& upload, const sf::Clock& clock, sf::Time budget) {
+    if (!upload.texture) {
+        const sf::Vector2u size = upload.image->getSize();
+        upload.texture = std::make_shared<sf::Texture>();
+        if (!upload.texture->create(size.x, size.y)) {
+            upload.texture = nullptr;
+            return true;
+        }
+    }
+
+    const sf::Vector2u size = upload.image->getSize();
+    const sf::Uint8* pixels = upload.image->getPixelsPtr();
+    while (upload.nextRow < size.y && clock.getElapsedTime() < budget) {
+        unsigned rows = std::min(UPLOAD_STRIPE_ROWS, size.y - upload.nextRow);
+        upload.texture->update(pixels + static_cast<std::size_t>(upload.nextRow) * size.x * 4,
+            size.x, rows, 0, upload.nextRow);
+        upload.nextRow += rows;
+    }
+    return upload.nextRow >= size.y;
+}
+
+void AssetCache::pumpUploads(sf::Time budget) {
+    sf::Clock clock;
+    AssetLoader& assetLoader = getLoader();
+
+    while (!uploads.empty() && clock.getElapsedTime() < budget) {
+        // Work on the first texture whose pixels are available; the rest keep decoding meanwhile
+        auto it = std::find_if(uploads.begin(), uploads.end(), [&](const PendingUpload& upload) {
+            return upload.image || assetLoader.isReady(upload.path);
+        });
+        if (it == uploads.end())
+            break;
+
+        if (!it->image) {
+            it->image = assetLoader.take(it->path);
+            if (!it->image) {
+                std::cout << "Failed to load texture: " << it->path << "\n";
+                stats.misses++;
+                stats.failures++;
+                textures[it->path] = nullptr;
+                uploads.erase(it);
+                continue;
+            }
+        }
+
+        if (uploadRows(*it, clock, budget)) {
+            stats.misses++;
+            if (it->texture)
+                stats.bytesLoaded += textureBytes(*it->texture);
+            else
+                stats.failures++;
+            textures[it->path] = it->texture;
+            touchTexture(it->path, false);
+            uploads.erase(it);
+        }
+    }
+
+    // Build atlases whose pages are uploaded (baked) or whose sprites are all decoded (packed here)
+    for (auto it = pendingAtlases.begin(); it != pendingAtlases.end() && clock.getElapsedTime() < budget;) {
+        const PendingAtlas& pending = it->second;
+        bool ready = std::all_of(pending.files.begin(), pending.files.end(), [&](const std::string& file) {
+            return pending.baked ? textures.count(file) > 0
+                                 : !assetLoader.has(file) || assetLoader.isReady(file);
+        });
+        if (!ready) {
+            ++it;
+            continue;
+        }
+        const std::string name = it->first;
+        it = pendingAtlases.erase(it);
+        if (atlases.count(name))
+            continue;
+        // Nobody has asked for it yet, so its pages shouldn't count against the current screen
+        const std::string activeScope = scope;
+        scope.clear();
+        loadAtlas(name);
+        touchAtlas(name, false);
+        scope = activeScope;
+    }
+}
+
+bool AssetCache::isLoading() const {
+    return !uploads.empty() || !pendingAtlases.empty();
+}
+
+bool AssetCache::isReady(const AssetList& assets) const {
+    for (const auto& path : assets.textures) {
+        if (!textures.count(path))
+            return false;
+    }
+    for (const auto& name : assets.atlases) {
+        if (!atlases.count(name))
+            return false;
+    }
+    return true;
+}
+
+std::shared_ptr<sf::Texture> AssetCache::storeTexture(const std::string& key, const sf::Image& image) {
+    auto tex = std::make_shared<sf::Texture>();
+    if (!tex->loadFromImage(image)) {
+        std::cout << "Failed to upload texture: " << key << "\n";
+        stats.failures++;
+        return nullptr;
+    }
+    stats.bytesLoaded += textureBytes(*tex);
+    textures[key] = tex;
+    touchTexture(key, true);
+    return tex;
+}
+
+std::shared_ptr<SpriteAtlas> AssetCache::getAtlas(const std::string& name) {
+    auto it = atlases.find(name);
+    if (it != atlases.end()) {
+        stats.hits++;
+        touchAtlas(name, true);
+        return it->second;
+    }
+
+    auto atlas = loadAtlas(name);
+    touchAtlas(name, true);
+    return atlas;
+}
+
+std::shared_ptr<SpriteAtlas> AssetCache::loadAtlas(const std::string& name) {
+    stats.misses++;
+    pendingAtlases.erase(name);
+    auto atlas = std::make_shared<SpriteAtlas>();
+    if (!atlas->load(name)) {
+        std::cout << "Failed to load atlas: " << name << "\n";
+        stats.failures++;
+        atlas = nullptr;
+    }
+    atlases[name] = atlas;
+    return atlas;
+}
+
+std::shared_ptr<sf::Font> AssetCache::getFont(const std::string& path) {
+    auto it = fonts.find(path);
+    if (it != fonts.end()) {
+        stats.hits++;
+        return it->second;
+    }
+
+    stats.misses++;
+    // sf::Font streams glyphs from its source, so a packed font points straight into the mapping
+    auto font = std::make_shared<sf::Font>();
+    const AssetPack& pack = AssetPack::instance();
+    const AssetPack::Entry* entry = pack.findCurrent(path);
+    bool loaded = entry ? font->loadFromMemory(pack.data(*entry), static_cast<std::size_t>(entry->size))
+                        : font->loadFromFile(path);
+    if (!loaded) {
+        std::cerr << "Error loading font: " << path << "\n";
+        stats.failures++;
+        font = nullptr;
+    }
+    fonts[path] = font;
+    return font;
+}
+
+void AssetCache::releaseUnused() {
+    fenceRelease();
+    // Atlases go first so the pages they hold become releasable below
+    for (auto it = atlases.begin(); it != atlases.end();) {
+        if (it->second && it->second.use_count() == 1) {
+            atlasLastUse.erase(it->first);
+            it = atlases.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    for (auto it = textures.begin(); it != textures.end();) {
+        // use_count 1 means only the cache itself still owns the texture
+        if (it->second && it->second.use_count() == 1) {
+            residency.erase(it->first);
+            it = textures.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+    for (auto it = fonts.begin(); it != fonts.end();) {
+        if (it->second && it->second.use_count() == 1)
+            it = fonts.erase(it);
+        else
+            ++it;
+    }
+}
+
+std::size_t AssetCache::getResidentBytes() const {
+    std::size_t total = 0;
+    for (const auto& [path, tex] : textures) {
+        if (tex) total += textureBytes(*tex);
+    }
+    return total;
+}
+
+void AssetCache::printStats(std::ostream& out) const {
+    out << "[AssetCache] hits: " << stats.hits
+        << ", misses: " << stats.misses
+        << ", failures: " << stats.failures
+        << ", uploaded: " << stats.bytesLoaded / 1024 << " KB"
+        << ", evicted: " << stats.evictions
+        << ", resident: " << getResidentBytes() / 1024 << " KB in " << textures.size() << " textures\n";
+}
+
+void AssetCache::setScope(const std::string& name) {
+    scope = name;
+}
+
+void AssetCache::touchTexture(const std::string& path, bool tag) {
+    auto it = textures.find(path);
+    if (it == textures.end() || !it->second)
+        return;
+    Residency& info = residency[path];
+    info.bytes = textureBytes(*it->second);
+    info.lastUse = ++useClock;
+    if (tag && !scope.empty())
+        info.scopes.insert(scope);
+}
+
+void AssetCache::touchAtlas(const std::string& name, bool tag) {
+    auto it = atlases.find(name);
+    if (it == atlases.end() || !it->second)
+        return;
+    // Untagged atlases have only been prefetched; enforceBudget leaves them to the Preloader
+    if (tag)
+        atlasLastUse[name] = ++useClock;
+
+    const auto& pages = it->second->getPages();
+    for (const auto& [path, tex] : textures) {
+        if (tex && std::find(pages.begin(), pages.end(), tex) != pages.end())
+            touchTexture(path, tag);
+    }
+}
+
+void AssetCache::enforceBudget() {
+    if (budget == 0)
+        return;
+
+    const std::uint64_t never = std::numeric_limits<std::uint64_t>::max();
+    std::size_t resident = getResidentBytes();
+    while (resident > budget) {
+        // Least recently used texture that only the cache holds and some screen has actually used
+        std::string oldestTexture;
+        std::uint64_t textureUse = never;
+        for (const auto& [path, tex] : textures) {
+            if (!tex || tex.use_count() != 1)
+                continue;
+            auto info = residency.find(path);
+            if (info == residency.end() || info->second.scopes.empty())
+                continue;
+            if (info->second.lastUse < textureUse) {
+                textureUse = info->second.lastUse;
+                oldestTexture = path;
+            }
+        }
+
+        // Same for atlases; dropping one frees its pages
+        std::string oldestAtlas;
+        std::uint64_t atlasUse = never;
+        for (const auto& [name, atlas] : atlases) {
+            if (!atlas || atlas.use_count() != 1)
+                continue;
+            auto use = atlasLastUse.find(name);
+            if (use != atlasLastUse.end() && use->second < atlasUse) {
+                atlasUse = use->second;
+                oldestAtlas = name;
+            }
+        }
+
+        if (oldestTexture.empty() && oldestAtlas.empty())
+            break; // Everything left is in use or still a speculative prefetch
+
+        if (!oldestAtlas.empty() && atlasUse < textureUse) {
+            dropAtlas(atlases.find(oldestAtlas));
+        }
+        else {
+            fenceRelease();
+            residency.erase(oldestTexture);
+            textures.erase(oldestTexture);
+        }
+        stats.evictions++;
+        resident = getResidentBytes();
+    }
+}
+
+void AssetCache::printResidency(std::ostream& out) const {
+    struct ScopeTotal {
+        std::size_t bytes = 0;
+        std::size_t count = 0;
+    };
+    std::map<std::string, ScopeTotal> totals;
+    for (const auto& [path, info] : residency) {
+        if (info.scopes.empty()) {
+            totals["(prefetched)"].bytes += info.bytes;
+            totals["(prefetched)"].count++;
+        }
+        // A texture shared by several screens is listed under each of them
+        for (const auto& name : info.scopes) {
+            totals[name].bytes += info.bytes;
+            totals[name].count++;
+        }
+    }
+
+    out << "[AssetCache] resident: " << getResidentBytes() / 1024 << " KB, budget: ";
+    if (budget == 0)
+        out << "unlimited\n";
+    else
+        out << budget / 1024 << " KB\n";
+    for (const auto& [name, total] : totals)
+        out << "  " << name << ": " << total.bytes / 1024 << " KB in " << total.count << " textures\n";
+}
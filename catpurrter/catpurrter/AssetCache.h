@@ -0,0 +1,186 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class AssetLoader;
+class SpriteAtlas;
+
+// AssetList names everything a view needs before its init() can run without touching the disk.
+struct AssetList {
+    std::vector<std::string> textures; // Standalone texture paths.
+    std::vector<std::string> atlases;  // Atlas names (see AtlasPacker::manifest).
+};
+
+// AssetCache is the process-wide store for textures and fonts loaded from disk.
+// Views borrow shared handles from it by path, so each file is decoded and uploaded once per process,
+// no matter how many times GameManager rebuilds a view.
+// Also keeps hit/miss/byte counters so we can see how much loading a view switch still causes.
+//
+// Files can be prefetched: workers decode them in the background and pumpUploads() (called once per
+// frame on the main thread) turns them into textures a few rows at a time, so no single frame
+// pays for a whole 800x600 upload.
+//
+// Every texture also carries residency info: its size, when it was last handed out and which screens
+// (GameStates, see setScope) asked for it. enforceBudget() drops the least recently used textures
+// nobody holds once the total goes over the budget, so machines with little VRAM don't keep
+// every full-screen background around.
+class AssetCache {
+public:
+    // Counters describing cache activity since startup.
+    struct Stats {
+        std::size_t hits = 0;         // Requests served from an already loaded asset.
+        std::size_t misses = 0;       // Requests that had to read the file from disk.
+        std::size_t failures = 0;     // Files that could not be loaded.
+        std::size_t bytesLoaded = 0;  // Texture bytes uploaded so far (width * height * 4).
+        std::size_t evictions = 0;    // Textures and atlases dropped to stay within the budget.
+    };
+
+    // Returns the single shared cache.
+    static AssetCache& instance();
+
+    // Returns the texture at the given path, loading it on first use.
+    // Returns nullptr if the file can't be loaded (the failure is remembered, so the disk isn't hit again).
+    std::shared_ptr<sf::Texture> getTexture(const std::string& path);
+
+    // Uploads an image built in memory (e.g. a runtime-packed atlas page) and caches it under key.
+    // Returns nullptr if the upload fails.
+    std::shared_ptr<sf::Texture> storeTexture(const std::string& key, const sf::Image& image);
+
+    // Returns the named sprite atlas ("room", "closeup" or "aquarium"), loading it on first use (nullptr if it can't be loaded).
+    std::shared_ptr<SpriteAtlas> getAtlas(const std::string& name);
+
+    // Starts decoding everything in the list in the background (already cached assets are skipped).
+    void prefetch(const AssetList& assets);
+
+    // Uploads decoded prefetches to the GPU until budget runs out. Call once per frame on the main thread.
+    void pumpUploads(sf::Time budget);
+
+    // Returns true while prefetched assets are still being decoded or uploaded.
+    bool isLoading() const;
+
+    // Returns true once every asset in the list is cached (or known to have failed), so a view using
+    // only these assets can init() without loading anything.
+    bool isReady(const AssetList& assets) const;
+
+    // Stops prefetching the listed assets: queued decodes are dropped, uploads not started yet are skipped.
+    void cancelPrefetch(const AssetList& assets);
+
+    // Drops the listed textures and atlases from the cache if nothing outside the cache still uses them.
+    void evict(const AssetList& assets);
+
+    // Returns the worker pool used for background decoding (created on first use).
+    AssetLoader& getLoader();
+
+    // Returns the font at the given path, loading it on first use (nullptr if it can't be loaded).
+    std::shared_ptr<sf::Font> getFont(const std::string& path);
+
+    // Drops every cached asset that no view is holding on to anymore.
+    void releaseUnused();
+
+    // Returns the hit/miss/byte counters.
+    const Stats& getStats() const { return stats; }
+
+    // Returns how many bytes of texture data are currently held by the cache.
+    std::size_t getResidentBytes() const;
+
+    // Prints the counters and resident size (used by the F3 debug key).
+    void printStats(std::ostream& out) const;
+
+    // Names the active screen; textures and atlases handed out from now on are recorded as used by it.
+    void setScope(const std::string& scope);
+
+    // Sets how many bytes of textures may stay resident (0 = no limit).
+    void setBudget(std::size_t bytes) { budget = bytes; }
+
+    // Returns the resident texture budget in bytes (0 = no limit).
+    std::size_t getBudget() const { return budget; }
+
+    // Returns true if the resident textures exceed the budget.
+    bool isOverBudget() const { return budget != 0 && getResidentBytes() > budget; }
+
+    // Evicts least recently used textures and atlases that no view holds until the resident size fits the budget.
+    // Prefetched assets nobody has asked for yet are left to the Preloader.
+    void enforceBudget();
+
+    // Prints resident bytes per screen plus the total against the budget (used by the F3 debug key).
+    void printResidency(std::ostream& out) const;
+
+    // Sets a function called before any texture, atlas or font is dropped. The renderer uses it to
+    // finish the frame it's drawing, which may still point at the asset.
+    void setReleaseFence(std::function<void()> fence) { releaseFence = std::move(fence); }
+
+private:
+    AssetCache();
+    ~AssetCache();
+    AssetCache(const AssetCache&) = delete;
+    AssetCache& operator=(const AssetCache&) = delete;
+
+    std::unordered_map<std::string, std::shared_ptr<sf::Texture>> textures; // Loaded textures by path (nullptr = failed).
+    std::unordered_map<std::string, std::shared_ptr<sf::Font>> fonts;       // Loaded fonts by path (nullptr = failed).
+    std::unordered_map<std::string, std::shared_ptr<SpriteAtlas>> atlases;  // Loaded atlases by name (nullptr = failed).
+    Stats stats;                                                            // Hit/miss/byte counters.
+
+    // Residency info for one cached texture.
+    struct Residency {
+        std::size_t bytes = 0;          // Texture size on the GPU (width * height * 4).
+        std::uint64_t lastUse = 0;      // useClock value when it was last handed out.
+        std::set<std::string> scopes;   // Screens that have asked for it (empty = only prefetched so far).
+    };
+
+    // Records a use of a cached texture by the current scope (or, with tag = false, only that it arrived).
+    void touchTexture(const std::string& path, bool tag);
+
+    // Records a use of an atlas and of its page textures (see touchTexture for tag).
+    void touchAtlas(const std::string& name, bool tag);
+
+    // Builds an atlas (the miss path of getAtlas).
+    std::shared_ptr<SpriteAtlas> loadAtlas(const std::string& name);
+
+    // Removes an atlas and then every page texture only the cache still holds.
+    void dropAtlas(std::unordered_map<std::string, std::shared_ptr<SpriteAtlas>>::iterator it);
+
+    // Runs the release fence (if any) before something is dropped.
+    void fenceRelease() const;
+
+    std::unordered_map<std::string, Residency> residency;                   // Residency of cached textures, by path.
+    std::unordered_map<std::string, std::uint64_t> atlasLastUse;            // useClock value of each atlas' last use.
+    std::string scope;                                                      // Screen currently asking for assets.
+    std::uint64_t useClock = 0;                                             // Ticks on every use, orders residency by recency.
+    std::size_t budget = 0;                                                 // Resident texture budget in bytes (0 = no limit).
+    std::function<void()> releaseFence;                                     // Called before dropping assets (see setReleaseFence).
+
+    // A prefetched texture on its way to the GPU.
+    struct PendingUpload {
+        std::string path;                    // File (and cache key) of the texture.
+        std::unique_ptr<sf::Image> image;    // Decoded pixels, taken from the loader once ready.
+        std::shared_ptr<sf::Texture> texture; // Texture being filled in.
+        unsigned nextRow = 0;                // First row not uploaded yet.
+    };
+
+    // Queues one texture for background decoding and sliced upload.
+    void prefetchTexture(const std::string& path);
+
+    // Queues the files an atlas is built from (baked pages, or the loose sprites to pack).
+    void prefetchAtlas(const std::string& name);
+
+    // Uploads rows of one pending texture until the deadline; returns true when the texture is complete.
+    bool uploadRows(PendingUpload& upload, const sf::Clock& clock, sf::Time budget);
+
+    std::unique_ptr<AssetLoader> loader;                                    // Background decode threads.
+    std::deque<PendingUpload> uploads;                                      // Prefetched textures not on the GPU yet.
+    // An atlas waiting for its files before it can be built.
+    struct PendingAtlas {
+        bool baked = false;              // files are page textures (true) or loose sprites to pack (false).
+        std::vector<std::string> files;  // Files the atlas is waiting for.
+    };
+    std::map<std::string, PendingAtlas> pendingAtlases;                     // Atlases being prefetched, by name.
+};
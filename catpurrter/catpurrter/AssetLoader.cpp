@@ -0,0 +1,142 @@
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include <algorithm>
+#include <iostream>
+
+AssetLoader::AssetLoader(unsigned threadCount) {
+    if (threadCount == 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        threadCount = hw > 1 ? hw - 1 : 1;
+    }
+    for (unsigned i = 0; i < threadCount; ++i)
+        workers.emplace_back(&AssetLoader::workerLoop, this);
+}
+
+AssetLoader::~AssetLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        queue.clear();
+    }
+    jobQueued.notify_all();
+    for (auto& worker : workers)
+        worker.join();
+}
+
+void AssetLoader::request(const std::string& path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = jobs.find(path);
+        if (it != jobs.end()) {
+            it->second->cancelled = false; // Wanted again before the worker finished it
+            return;
+        }
+        auto job = std::make_shared<Job>();
+        job->path = path;
+        jobs[path] = job;
+        queue.push_back(job);
+        pending++;
+    }
+    jobQueued.notify_one();
+}
+
+bool AssetLoader::isReady(const std::string& path) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = jobs.find(path);
+    return it != jobs.end() && it->second->done;
+}
+
+bool AssetLoader::has(const std::string& path) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs.count(path) > 0;
+}
+
+std::unique_ptr<sf::Image> AssetLoader::take(const std::string& path) {
+    std::shared_ptr<Job> job;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        auto it = jobs.find(path);
+        if (it != jobs.end()) {
+            job = it->second;
+            if (!job->started) {
+                // Nobody got to it yet, so decode it here instead of waiting behind the queue
+                queue.erase(std::remove(queue.begin(), queue.end(), job), queue.end());
+                jobs.erase(it);
+                pending--;
+                job = nullptr;
+            }
+            else {
+                job->cancelled = false;
+                jobDone.wait(lock, [&] { return job->done; });
+                jobs.erase(path);
+            }
+        }
+    }
+
+    if (!job) {
+        auto image = std::make_unique<sf::Image>();
+        if (!AssetPack::instance().loadImage(path, *image)) {
+            std::cout << "Failed to decode image: " << path << "\n";
+            return nullptr;
+        }
+        return image;
+    }
+    return std::move(job->image);
+}
+
+void AssetLoader::cancel(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = jobs.find(path);
+    if (it == jobs.end())
+        return;
+    std::shared_ptr<Job> job = it->second;
+    if (job->started && !job->done) {
+        job->cancelled = true;
+        return;
+    }
+    if (!job->started) {
+        queue.erase(std::remove(queue.begin(), queue.end(), job), queue.end());
+        pending--;
+    }
+    jobs.erase(it);
+}
+
+std::size_t AssetLoader::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return pending;
+}
+
+void AssetLoader::workerLoop() {
+    while (true) {
+        std::shared_ptr<Job> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            jobQueued.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (stopping)
+                return;
+            job = queue.front();
+            queue.pop_front();
+            job->started = true;
+        }
+
+        // sf::Image decoding is plain CPU work, so it's safe off the render thread
+        auto image = std::make_unique<sf::Image>();
+        if (!AssetPack::instance().loadImage(job->path, *image)) {
+            std::cout << "Failed to decode image: " << job->path << "\n";
+            image = nullptr;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job->image = std::move(image);
+            job->done = true;
+            pending--;
+            if (job->cancelled) {
+                auto it = jobs.find(job->path);
+                if (it != jobs.end() && it->second == job)
+                    jobs.erase(it);
+            }
+        }
+        jobDone.notify_all();
+    }
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// AssetLoader decodes PNG files into sf::Image on a small pool of worker threads
+// (reading them from the AssetPack when there is one).
+// It only touches CPU memory; turning the images into textures is up to the caller on the main
+// thread (AssetCache does that a few stripes at a time in pumpUploads()).
+class AssetLoader {
+public:
+    // Starts threadCount workers (0 = one less than the number of hardware threads, at least one).
+    explicit AssetLoader(unsigned threadCount = 0);
+
+    // Stops the workers; images still queued are dropped.
+    ~AssetLoader();
+
+    // Queues the file for decoding. Does nothing if it's already queued or decoded.
+    void request(const std::string& path);
+
+    // Returns true once the file has been decoded (successfully or not) and is waiting to be taken.
+    bool isReady(const std::string& path) const;
+
+    // Returns true if the file is queued, decoding or decoded but not taken yet.
+    bool has(const std::string& path) const;
+
+    // Removes the file's image from the loader and hands it over, waiting for the worker if needed.
+    // A file that was never requested (or not started yet) is decoded right here.
+    // Returns nullptr if the file couldn't be decoded.
+    std::unique_ptr<sf::Image> take(const std::string& path);
+
+    // Forgets the file: drops it from the queue, or throws the result away once a worker finishes it.
+    void cancel(const std::string& path);
+
+    // Returns how many files are queued or still decoding.
+    std::size_t getPendingCount() const;
+
+private:
+    // One decode request and its result.
+    struct Job {
+        std::string path;   // File to decode.
+        std::unique_ptr<sf::Image> image; // Decoded pixels (nullptr if decoding failed).
+        bool started = false; // A worker (or take()) picked the job up.
+        bool done = false;  // Decoding finished.
+        bool cancelled = false; // Nobody wants the result anymore; the worker drops it.
+    };
+
+    // Worker thread body: pops queued jobs and decodes them until the loader shuts down.
+    void workerLoop();
+
+    mutable std::mutex mutex;                                  // Guards everything below.
+    std::condition_variable jobQueued;                         // Signalled when a job is queued or on shutdown.
+    std::condition_variable jobDone;                           // Signalled when a job finishes.
+    std::deque<std::shared_ptr<Job>> queue;                    // Jobs waiting for a worker (FIFO).
+    std::unordered_map<std::string, std::shared_ptr<Job>> jobs; // All jobs not taken yet, by path.
+    std::size_t pending = 0;                                   // Jobs not done yet.
+    bool stopping = false;                                     // Set by the destructor.
+    std::vector<std::thread> workers;                          // Decode threads.
+};
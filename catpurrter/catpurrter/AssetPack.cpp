@@ -0,0 +1,310 @@
+#include "AssetPack.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    const char PACK_MAGIC[4] = { 'C', 'P', 'A', 'K' };
+    const std::uint32_t PACK_VERSION = 2;
+    const std::string PACK_PATH = "assets/assets.pak";
+
+    // File header, followed by entryCount Entry records and then the data.
+    struct Header {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t entryCount;
+        std::uint32_t reserved;
+    };
+
+    static_assert(sizeof(Header) == 16, "pack header layout changed");
+    static_assert(sizeof(AssetPack::Entry) == 56, "pack entry layout changed");
+
+#ifdef _DEBUG
+    // Debug builds are where assets get edited: hash each loose file and let it win over a stale entry
+    const bool CHECK_LOOSE_FILES = true;
+#else
+    const bool CHECK_LOOSE_FILES = false;
+#endif
+
+    std::uint64_t pathHash(const std::string& path) {
+        return AssetPack::hash(path.data(), path.size());
+    }
+
+    // Reads a whole file from disk.
+    bool readLooseFile(const std::string& path, std::string& out) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open())
+            return false;
+        out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        return true;
+    }
+}
+
+AssetPack& AssetPack::instance() {
+    static AssetPack pack;
+    static bool opened = [] {
+        if (!std::filesystem::exists(PACK_PATH)) {
+            std::cout << "No asset pack (run assettool pack), loading loose files\n";
+            return false;
+        }
+        return pack.open(PACK_PATH);
+    }();
+    (void)opened;
+    return pack;
+}
+
+AssetPack::~AssetPack() {
+    close();
+}
+
+bool AssetPack::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        CloseHandle(file);
+        return false;
+    }
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    base = static_cast<const unsigned char*>(view);
+    mappedSize = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        ::close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // The mapping keeps the file alive
+    if (view == MAP_FAILED)
+        return false;
+    base = static_cast<const unsigned char*>(view);
+    mappedSize = static_cast<std::size_t>(st.st_size);
+#endif
+
+    Header header;
+    if (mappedSize < sizeof(Header)) {
+        close();
+        return false;
+    }
+    std::memcpy(&header, base, sizeof(Header));
+    if (std::memcmp(header.magic, PACK_MAGIC, 4) != 0 || header.version != PACK_VERSION
+        || sizeof(Header) + static_cast<std::size_t>(header.entryCount) * sizeof(Entry) > mappedSize) {
+        std::cout << "Asset pack is broken or outdated: " << path << "\n";
+        close();
+        return false;
+    }
+
+    entries = reinterpret_cast<const Entry*>(base + sizeof(Header));
+    entryCount = header.entryCount;
+    for (std::uint32_t i = 0; i < entryCount; ++i) {
+        if (entries[i].offset + entries[i].size > mappedSize) {
+            std::cout << "Asset pack entry out of bounds: " << path << "\n";
+            close();
+            return false;
+        }
+    }
+    std::cout << "Mapped asset pack " << path << " (" << entryCount << " entries, " << mappedSize / 1024 << " KB)\n";
+    return true;
+}
+
+void AssetPack::close() {
+#ifdef _WIN32
+    if (base)
+        UnmapViewOfFile(base);
+    if (mappingHandle)
+        CloseHandle(mappingHandle);
+    if (fileHandle)
+        CloseHandle(fileHandle);
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    if (base)
+        munmap(const_cast<unsigned char*>(base), mappedSize);
+#endif
+    base = nullptr;
+    mappedSize = 0;
+    entries = nullptr;
+    entryCount = 0;
+}
+
+const AssetPack::Entry* AssetPack::find(const std::string& path) const {
+    if (!entries)
+        return nullptr;
+    const std::uint64_t key = pathHash(path);
+    const Entry* end = entries + entryCount;
+    const Entry* it = std::lower_bound(entries, end, key,
+        [](const Entry& entry, std::uint64_t value) { return entry.pathHash < value; });
+    return (it != end && it->pathHash == key) ? it : nullptr;
+}
+
+bool AssetPack::isIntact(const Entry& entry) const {
+    return hash(data(entry), static_cast<std::size_t>(entry.size)) == entry.contentHash;
+}
+
+bool AssetPack::matchesSource(const Entry& entry, const std::string& path) {
+    std::string bytes;
+    if (!readLooseFile(path, bytes))
+        return true;
+    return hash(bytes.data(), bytes.size()) == entry.sourceHash;
+}
+
+const AssetPack::Entry* AssetPack::findCurrent(const std::string& path) const {
+    const Entry* entry = find(path);
+    if (entry && CHECK_LOOSE_FILES && !matchesSource(*entry, path)) {
+        std::cout << "Asset pack is stale for " << path << " (run assettool pack), loading the loose file\n";
+        return nullptr;
+    }
+    return entry;
+}
+
+bool AssetPack::exists(const std::string& path) const {
+    return find(path) != nullptr || std::filesystem::exists(path);
+}
+
+bool AssetPack::loadImage(const std::string& path, sf::Image& image) const {
+    const Entry* entry = findCurrent(path);
+    if (!entry)
+        return image.loadFromFile(path);
+
+    if (entry->format == Format::Rgba) {
+        if (entry->size != static_cast<std::uint64_t>(entry->width) * entry->height * 4)
+            return false;
+        image.create(entry->width, entry->height, static_cast<const sf::Uint8*>(data(*entry)));
+        return true;
+    }
+    return image.loadFromMemory(data(*entry), static_cast<std::size_t>(entry->size));
+}
+
+bool AssetPack::readFile(const std::string& path, std::string& out) const {
+    const Entry* entry = findCurrent(path);
+    if (!entry)
+        return readLooseFile(path, out);
+    if (entry->format != Format::Raw)
+        return false;
+    out.assign(static_cast<const char*>(data(*entry)), static_cast<std::size_t>(entry->size));
+    return true;
+}
+
+std::uint64_t AssetPack::hash(const void* bytes, std::size_t size) {
+    std::uint64_t h = 14695981039346656037ull;
+    const unsigned char* p = static_cast<const unsigned char*>(bytes);
+    for (std::size_t i = 0; i < size; ++i) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+bool AssetPack::build(const std::string& packPath, const std::vector<std::string>& files, bool storeRgba) {
+    struct Item {
+        Entry entry;
+        std::string bytes;
+        std::string path;
+    };
+    std::vector<Item> items;
+
+    for (const auto& path : files) {
+        Item item;
+        item.path = path;
+        item.entry.pathHash = pathHash(path);
+
+        std::string ext = std::filesystem::path(path).extension().string();
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        std::string source;
+        if (!readLooseFile(path, source)) {
+            std::cout << "Pack: couldn't read " << path << "\n";
+            return false;
+        }
+        item.entry.sourceHash = hash(source.data(), source.size());
+
+        sf::Image image;
+        if (storeRgba && ext == ".png" && image.loadFromMemory(source.data(), source.size())) {
+            item.entry.format = Format::Rgba;
+            item.entry.width = image.getSize().x;
+            item.entry.height = image.getSize().y;
+            item.bytes.assign(reinterpret_cast<const char*>(image.getPixelsPtr()),
+                static_cast<std::size_t>(item.entry.width) * item.entry.height * 4);
+        }
+        else {
+            item.bytes = std::move(source);
+        }
+        item.entry.size = item.bytes.size();
+        item.entry.contentHash = hash(item.bytes.data(), item.bytes.size());
+        items.push_back(std::move(item));
+    }
+
+    std::sort(items.begin(), items.end(),
+        [](const Item& a, const Item& b) { return a.entry.pathHash < b.entry.pathHash; });
+    for (size_t i = 1; i < items.size(); ++i) {
+        if (items[i].entry.pathHash == items[i - 1].entry.pathHash) {
+            std::cout << "Pack: path hash collision between " << items[i - 1].path << " and " << items[i].path << "\n";
+            return false;
+        }
+    }
+
+    // Data starts after the index; every entry is 16-byte aligned so RGBA rows can be read directly
+    auto align = [](std::uint64_t value) { return (value + 15) & ~std::uint64_t(15); };
+    std::uint64_t offset = align(sizeof(Header) + items.size() * sizeof(Entry));
+    for (auto& item : items) {
+        item.entry.offset = offset;
+        offset = align(offset + item.entry.size);
+    }
+
+    std::ofstream out(packPath, std::ios::binary);
+    if (!out.is_open()) {
+        std::cout << "Pack: couldn't write " << packPath << "\n";
+        return false;
+    }
+    Header header;
+    std::memcpy(header.magic, PACK_MAGIC, 4);
+    header.version = PACK_VERSION;
+    header.entryCount = static_cast<std::uint32_t>(items.size());
+    header.reserved = 0;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const auto& item : items)
+        out.write(reinterpret_cast<const char*>(&item.entry), sizeof(Entry));
+
+    std::uint64_t written = sizeof(Header) + items.size() * sizeof(Entry);
+    const char padding[16] = {};
+    for (const auto& item : items) {
+        out.write(padding, static_cast<std::streamsize>(item.entry.offset - written));
+        out.write(item.bytes.data(), static_cast<std::streamsize>(item.bytes.size()));
+        written = item.entry.offset + item.entry.size;
+    }
+    return static_cast<bool>(out);
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// AssetPack is a single memory-mapped archive (assets/assets.pak) holding every game asset,
+// built by `assettool pack`. Entries are found by a hash of their original relative path
+// ("assets/graphics/room.png"), so callers keep using the same paths as before.
+// Images can be stored as raw RGBA, which turns loading into a memcpy: no open/seek per file
+// and no PNG inflate. When there is no pack, everything falls back to the loose files.
+// Each entry also records a hash of the file it was packed from, so `assettool verify` can list
+// assets edited since the last pack, and Debug builds load an edited loose file instead of its stale entry.
+class AssetPack {
+public:
+    // How an entry's bytes are stored.
+    enum class Format : std::uint32_t {
+        Raw = 0,   // The original file bytes (PNG, TTF, JSON...).
+        Rgba = 1   // Decoded image: width * height * 4 bytes.
+    };
+
+    // One index record. Entries are sorted by pathHash so lookups are a binary search.
+    struct Entry {
+        std::uint64_t pathHash = 0;    // FNV-1a of the relative path.
+        std::uint64_t contentHash = 0; // FNV-1a of the stored bytes (isIntact).
+        std::uint64_t sourceHash = 0;  // FNV-1a of the file the entry was packed from (matchesSource).
+        std::uint64_t offset = 0;      // Start of the data from the beginning of the file.
+        std::uint64_t size = 0;        // Size of the data in bytes.
+        Format format = Format::Raw;   // Raw file bytes or decoded RGBA.
+        std::uint32_t width = 0;       // Image width (Rgba only).
+        std::uint32_t height = 0;      // Image height (Rgba only).
+        std::uint32_t reserved = 0;    // Keeps the record 56 bytes.
+    };
+
+    // Returns the process-wide pack, mapping assets/assets.pak on first use (empty if there is none).
+    static AssetPack& instance();
+
+    ~AssetPack();
+
+    // Maps the pack file. Returns false (and stays empty) if it's missing or malformed.
+    bool open(const std::string& path);
+
+    // Returns true if a pack is mapped.
+    bool isOpen() const { return base != nullptr; }
+
+    // Returns the entry for a relative path, or nullptr if the pack doesn't have it.
+    const Entry* find(const std::string& path) const;
+
+    // Returns the entry to load path from: like find, but nullptr in Debug builds when the loose file
+    // was edited since it was packed (so the caller loads the loose file).
+    const Entry* findCurrent(const std::string& path) const;
+
+    // Returns a pointer to an entry's bytes inside the mapping (valid for the lifetime of the process).
+    const void* data(const Entry& entry) const { return base + entry.offset; }
+
+    // Returns the number of entries in the pack.
+    std::uint32_t getEntryCount() const { return entryCount; }
+
+    // Returns true if the entry's stored bytes still hash to its contentHash.
+    bool isIntact(const Entry& entry) const;
+
+    // Returns true if the loose file at path is the one the entry was packed from (or there is no loose file).
+    static bool matchesSource(const Entry& entry, const std::string& path);
+
+    // Returns true if the path is in the pack or exists on disk.
+    bool exists(const std::string& path) const;
+
+    // Loads an image from the pack (memcpy for RGBA, decode for PNG) or from the loose file.
+    bool loadImage(const std::string& path, sf::Image& image) const;
+
+    // Reads a whole file (from the pack or disk) into out. Returns false if it doesn't exist.
+    bool readFile(const std::string& path, std::string& out) const;
+
+    // 64-bit FNV-1a hash used for both path and content hashes.
+    static std::uint64_t hash(const void* bytes, std::size_t size);
+
+    // Writes a pack containing the given files (relative paths). With storeRgba, PNGs are stored decoded.
+    static bool build(const std::string& packPath, const std::vector<std::string>& files, bool storeRgba);
+
+private:
+    AssetPack() = default;
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // Unmaps the file and closes handles.
+    void close();
+
+    const unsigned char* base = nullptr; // Start of the mapping.
+    std::size_t mappedSize = 0;          // Size of the mapping in bytes.
+    const Entry* entries = nullptr;      // Index records (inside the mapping).
+    std::uint32_t entryCount = 0;        // Number of index records.
+#ifdef _WIN32
+    void* fileHandle = nullptr;          // HANDLE of the pack file.
+    void* mappingHandle = nullptr;       // HANDLE of the file mapping.
+#endif
+};
@@ -0,0 +1,345 @@
+#include "AtlasPacker.h"
+#include "ImageScaler.h"
+#include "json.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <numeric>
+
+using json = nlohmann::json;
+
+AtlasPacker::AtlasPacker(unsigned pageSize, unsigned padding)
+    : pageSize(pageSize), padding(padding) {
+}
+
+void AtlasPacker::add(const std::string& id, const sf::Image& image) {
+    images.emplace_back(id, image);
+}
+
+void AtlasPacker::addLayer(const std::string& id, const sf::Image& image, const std::vector<std::string>& bases) {
+    layers.push_back({ id, image, bases });
+}
+
+void AtlasPacker::addScaled(const AtlasSource& source, const sf::Image& image) {
+    if (source.bases.empty())
+        add(source.id, image);
+    else
+        addLayer(source.id, image, source.bases);
+}
+
+void AtlasPacker::add(const AtlasSource& source, const sf::Image& image) {
+    if (source.scale >= 1.f) {
+        addScaled(source, image);
+        return;
+    }
+    sf::Image scaled;
+    if (!ImageScaler::downsample(image, scaled, ImageScaler::scaledSize(image.getSize(), source.scale))) {
+        std::cout << "Atlas: couldn't scale " << source.path << " for " << source.id << "\n";
+        return;
+    }
+    addScaled(source, scaled);
+}
+
+bool AtlasPacker::addFile(const AtlasSource& source) {
+    sf::Image image;
+    bool loaded = source.scale < 1.f ? ImageScaler::loadScaled(source.path, source.scale, image)
+                                     : image.loadFromFile(source.path);
+    if (!loaded) {
+        std::cout << "Atlas: couldn't read " << source.path << "\n";
+        return false;
+    }
+    addScaled(source, image);
+    return true;
+}
+
+namespace {
+    // Pixels the layer makes more transparent than the base; drawing over the base can't reproduce them.
+    std::size_t uncoveredPixels(const sf::Image& layer, const sf::Image& base) {
+        if (layer.getSize() != base.getSize())
+            return std::numeric_limits<std::size_t>::max() / 16;
+        const sf::Uint8* a = layer.getPixelsPtr();
+        const sf::Uint8* b = base.getPixelsPtr();
+        const std::size_t count = static_cast<std::size_t>(layer.getSize().x) * layer.getSize().y;
+        std::size_t uncovered = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (a[i * 4 + 3] < b[i * 4 + 3])
+                uncovered++;
+        }
+        return uncovered;
+    }
+
+    // Keeps only the layer pixels that differ from the base, cropped to their bounding box.
+    sf::Image differenceImage(const sf::Image& layer, const sf::Image& base, sf::Vector2i& offset) {
+        const sf::Vector2u size = layer.getSize();
+        unsigned left = size.x, top = size.y, right = 0, bottom = 0;
+        for (unsigned y = 0; y < size.y; ++y) {
+            for (unsigned x = 0; x < size.x; ++x) {
+                if (layer.getPixel(x, y) != base.getPixel(x, y)) {
+                    left = std::min(left, x);
+                    top = std::min(top, y);
+                    right = std::max(right, x + 1);
+                    bottom = std::max(bottom, y + 1);
+                }
+            }
+        }
+
+        sf::Image diff;
+        if (left >= right) {
+            // Nothing to add: a single transparent pixel keeps the id valid
+            diff.create(1, 1, sf::Color::Transparent);
+            offset = { 0, 0 };
+            return diff;
+        }
+        diff.create(right - left, bottom - top, sf::Color::Transparent);
+        for (unsigned y = top; y < bottom; ++y) {
+            for (unsigned x = left; x < right; ++x) {
+                const sf::Color pixel = layer.getPixel(x, y);
+                if (pixel != base.getPixel(x, y))
+                    diff.setPixel(x - left, y - top, pixel);
+            }
+        }
+        offset = { static_cast<int>(left), static_cast<int>(top) };
+        return diff;
+    }
+}
+
+void AtlasPacker::resolveLayers() {
+    auto findImage = [this](const std::string& id) -> const sf::Image* {
+        for (const auto& [imageId, image] : images) {
+            if (imageId == id) return &image;
+        }
+        return nullptr;
+    };
+
+    // Layers sharing the same bases (e.g. the two frames of one hat and direction) are matched together,
+    // so each gets a different base when possible and the walk animation keeps both poses
+    std::map<std::vector<std::string>, std::vector<size_t>> groups;
+    for (size_t i = 0; i < layers.size(); ++i)
+        groups[layers[i].bases].push_back(i);
+
+    for (const auto& [bases, members] : groups) {
+        std::vector<const sf::Image*> baseImages;
+        for (const auto& id : bases)
+            baseImages.push_back(findImage(id));
+        if (std::find(baseImages.begin(), baseImages.end(), nullptr) != baseImages.end()) {
+            // A base is missing: keep the full images so nothing disappears
+            std::cout << "Atlas: base sprite missing for layer " << layers[members.front()].id << ", storing it whole\n";
+            for (size_t i : members)
+                images.emplace_back(layers[i].id, layers[i].image);
+            continue;
+        }
+
+        std::vector<std::vector<std::size_t>> cost(members.size(), std::vector<std::size_t>(bases.size()));
+        for (size_t m = 0; m < members.size(); ++m) {
+            for (size_t b = 0; b < bases.size(); ++b)
+                cost[m][b] = uncoveredPixels(layers[members[m]].image, *baseImages[b]);
+        }
+
+        // Groups are tiny (two frames), so just try every assignment; the identity comes first and wins ties
+        std::vector<size_t> choice(members.size());
+        if (members.size() <= bases.size()) {
+            std::vector<size_t> order(bases.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::size_t best = std::numeric_limits<std::size_t>::max();
+            do {
+                std::size_t total = 0;
+                for (size_t m = 0; m < members.size(); ++m)
+                    total += cost[m][order[m]];
+                if (total < best) {
+                    best = total;
+                    std::copy(order.begin(), order.begin() + members.size(), choice.begin());
+                }
+            } while (std::next_permutation(order.begin(), order.end()));
+        }
+        else {
+            for (size_t m = 0; m < members.size(); ++m)
+                choice[m] = std::min_element(cost[m].begin(), cost[m].end()) - cost[m].begin();
+        }
+
+        for (size_t m = 0; m < members.size(); ++m) {
+            const Layer& layer = layers[members[m]];
+            sf::Vector2i offset;
+            images.emplace_back(layer.id, differenceImage(layer.image, *baseImages[choice[m]], offset));
+            layerPlacement[layer.id] = { bases[choice[m]], offset };
+        }
+    }
+    layers.clear();
+}
+
+bool AtlasPacker::pack() {
+    pages.clear();
+    regions.clear();
+    resolveLayers();
+
+    // Tallest sprites first keeps the rows tight
+    std::vector<size_t> order(images.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        const sf::Vector2u sa = images[a].second.getSize();
+        const sf::Vector2u sb = images[b].second.getSize();
+        if (sa.y != sb.y) return sa.y > sb.y;
+        if (sa.x != sb.x) return sa.x > sb.x;
+        return images[a].first < images[b].first;
+    });
+
+    // Current row cursor and used area for each page
+    struct PageLayout {
+        unsigned rowX = 0, rowY = 0, rowHeight = 0;
+        unsigned usedWidth = 0, usedHeight = 0;
+    };
+    std::vector<PageLayout> layouts(1);
+
+    for (size_t idx : order) {
+        const auto& [id, image] = images[idx];
+        const unsigned w = image.getSize().x;
+        const unsigned h = image.getSize().y;
+        if (w + padding > pageSize || h + padding > pageSize) {
+            std::cout << "Atlas: sprite " << id << " (" << w << "x" << h << ") is bigger than a page\n";
+            return false;
+        }
+
+        PageLayout* page = &layouts.back();
+        if (page->rowX + w + padding > pageSize) {
+            page->rowY += page->rowHeight;
+            page->rowX = 0;
+            page->rowHeight = 0;
+        }
+        if (page->rowY + h + padding > pageSize) {
+            layouts.emplace_back();
+            page = &layouts.back();
+        }
+
+        AtlasRegion region;
+        region.page = static_cast<unsigned>(layouts.size() - 1);
+        region.rect = sf::IntRect(page->rowX, page->rowY, w, h);
+        auto placement = layerPlacement.find(id);
+        if (placement != layerPlacement.end()) {
+            region.base = placement->second.first;
+            region.offset = placement->second.second;
+        }
+        regions[id] = region;
+
+        page->rowX += w + padding;
+        page->rowHeight = std::max(page->rowHeight, h + padding);
+        page->usedWidth = std::max(page->usedWidth, page->rowX);
+        page->usedHeight = std::max(page->usedHeight, page->rowY + h + padding);
+    }
+
+    // Pages are trimmed to the area actually used, so a half-empty page doesn't waste VRAM
+    pages.resize(layouts.size());
+    for (size_t i = 0; i < layouts.size(); ++i)
+        pages[i].create(std::max(1u, layouts[i].usedWidth), std::max(1u, layouts[i].usedHeight), sf::Color::Transparent);
+
+    for (const auto& [id, image] : images) {
+        const AtlasRegion& region = regions[id];
+        pages[region.page].copy(image, region.rect.left, region.rect.top);
+    }
+    return true;
+}
+
+bool AtlasPacker::save(const std::string& dir, const std::string& name) const {
+    std::filesystem::create_directories(dir);
+
+    json data;
+    data["pages"] = json::array();
+    for (size_t i = 0; i < pages.size(); ++i) {
+        std::string file = name + "_" + std::to_string(i) + ".png";
+        if (!pages[i].saveToFile(dir + "/" + file)) {
+            std::cout << "Atlas: couldn't write " << dir << "/" << file << "\n";
+            return false;
+        }
+        data["pages"].push_back(file);
+    }
+
+    json sprites = json::object();
+    for (const auto& [id, region] : regions) {
+        sprites[id] = {
+            { "page", region.page },
+            { "x", region.rect.left }, { "y", region.rect.top },
+            { "w", region.rect.width }, { "h", region.rect.height }
+        };
+        if (!region.base.empty()) {
+            sprites[id]["base"] = region.base;
+            sprites[id]["ox"] = region.offset.x;
+            sprites[id]["oy"] = region.offset.y;
+        }
+    }
+    data["sprites"] = sprites;
+
+    std::ofstream out(dir + "/" + name + ".json");
+    if (!out.is_open()) {
+        std::cout << "Atlas: couldn't write " << dir << "/" << name << ".json\n";
+        return false;
+    }
+    out << data.dump(4);
+    return true;
+}
+
+std::vector<std::string> AtlasPacker::atlasNames() {
+    return { "room", "closeup", "aquarium" };
+}
+
+std::vector<AtlasSource> AtlasPacker::manifest(const std::string& atlasName) {
+    const std::string gfx = "assets/graphics/";
+    const std::vector<std::string> fishIds = { "fish1", "fish2", "fish3" };
+    const std::vector<std::string> decoIds = { "car", "books", "plant", "picture" };
+    const std::vector<std::string> hatIds = { "crown", "pirate", "frog", "wizard" };
+    // Tank decorations (shop id, art name): each file is the empty tank with only that decoration added
+    const std::vector<std::pair<std::string, std::string>> tankDecorations = { { "plant", "plants" }, { "castle", "castle" } };
+
+    // Room-sized sprites are the close-up art scaled down
+    const float FISH_SMALL_SCALE = 1.f / 3.f;
+    const float ITEM_SMALL_SCALE = 0.3f;
+
+    std::vector<AtlasSource> sources;
+    if (atlasName == "room") {
+        // Everything Room::render draws except the full-screen background.
+        // Only the plain cat has full frames; hatted frames are stored as hat layers drawn over them.
+        // Left-facing frames are the right-facing ones drawn mirrored
+        for (const std::string dir : { "down", "up", "right" }) {
+            const std::vector<std::string> baseFrames = { "default_" + dir + "1", "default_" + dir + "2" };
+            for (int f = 1; f <= 2; ++f) {
+                std::string frame = dir + std::to_string(f);
+                sources.push_back({ "default_" + frame, gfx + "player/default/" + frame + ".png" });
+                for (const auto& hat : hatIds)
+                    sources.push_back({ hat + "_" + frame, gfx + "player/" + hat + "/" + frame + ".png", baseFrames });
+            }
+        }
+        for (const auto& id : fishIds)
+            sources.push_back({ id + "small", gfx + "aquarium/" + id + "rightbig.png", {}, FISH_SMALL_SCALE });
+        for (const auto& id : decoIds)
+            sources.push_back({ id + "small", gfx + "shelves/" + id + "big.png", {}, ITEM_SMALL_SCALE });
+        for (const auto& id : hatIds)
+            sources.push_back({ id + "small", gfx + "storagerack/" + id + "big.png", {}, ITEM_SMALL_SCALE });
+
+        sources.push_back({ "computer", gfx + "computer.png" });
+        sources.push_back({ "doors", gfx + "doors.png" });
+        sources.push_back({ "indicator", gfx + "indicator.png" });
+        sources.push_back({ "sr", gfx + "storagerack/sr.png" });
+        sources.push_back({ "shelves", gfx + "shelves/shelves.png" });
+        // The room aquarium is drawn at an angle, so it is its own art rather than a scaled close-up
+        sources.push_back({ "aquarium", gfx + "aquarium/aquarium.png" });
+        for (const auto& [id, file] : tankDecorations)
+            sources.push_back({ "aquarium_" + id, gfx + "aquarium/aquarium" + file + "small.png", { "aquarium" } });
+    }
+    else if (atlasName == "aquarium") {
+        // Fullscreen tank for the Aquarium view: the empty tank and one layer per decoration
+        sources.push_back({ "aquariumbig", gfx + "aquarium/aquariumbig.png" });
+        for (const auto& [id, file] : tankDecorations)
+            sources.push_back({ "aquariumbig_" + id, gfx + "aquarium/aquarium" + file + "big.png", { "aquariumbig" } });
+    }
+    else if (atlasName == "closeup") {
+        // Big sprites used by the fullscreen Aquarium, Shelf and StorageRack views
+        // Fish face right; left-facing ones are drawn mirrored
+        for (const auto& id : fishIds)
+            sources.push_back({ id + "big", gfx + "aquarium/" + id + "rightbig.png" });
+        for (const auto& id : decoIds)
+            sources.push_back({ id + "big", gfx + "shelves/" + id + "big.png" });
+        for (const auto& id : hatIds)
+            sources.push_back({ id + "big", gfx + "storagerack/" + id + "big.png" });
+    }
+    return sources;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+// AtlasSource names one sprite image that belongs in an atlas.
+struct AtlasSource {
+    std::string id;                      // Lookup id used by the game (e.g. "frog_right2", "fish1small").
+    std::string path;                    // Loose PNG the sprite is read from.
+    std::vector<std::string> bases = {}; // Layers only: ids of the sprites this image may be drawn over.
+    float scale = 1.f;                   // Below 1: the sprite is path downsampled by this factor (see ImageScaler).
+};
+
+// AtlasRegion is where a packed sprite ended up: which page and which pixel rectangle.
+struct AtlasRegion {
+    unsigned page = 0;    // Index of the atlas page.
+    sf::IntRect rect;     // Sub-rectangle of the sprite on that page.
+    std::string base;     // Layers only: id of the sprite to draw first ("" for ordinary sprites).
+    sf::Vector2i offset;  // Layers only: where the layer goes, relative to the base sprite's top-left.
+};
+
+// AtlasPacker packs many small sprite images into a few large atlas pages (row/shelf packing).
+// assettool uses it to bake atlases at build time; SpriteAtlas falls back to it at runtime
+// when no baked atlas is found, so both always produce the same layout.
+//
+// Sources with bases are layers: only the pixels that differ from the best matching base are kept
+// (cropped, with an offset), so e.g. a hatted cat frame shrinks to just the hat drawn over the plain frame.
+class AtlasPacker {
+public:
+    // Creates a packer producing pages at most pageSize x pageSize, with padding pixels between sprites.
+    AtlasPacker(unsigned pageSize = 2048, unsigned padding = 1);
+
+    // Adds an already decoded image under the given id.
+    void add(const std::string& id, const sf::Image& image);
+
+    // Adds an already decoded image as a layer over one of the base sprites (see AtlasSource::bases).
+    void addLayer(const std::string& id, const sf::Image& image, const std::vector<std::string>& bases);
+
+    // Adds a manifest entry decoded from source.path: scaled down if it has a scale,
+    // then added as a layer if it lists bases, as an ordinary sprite otherwise.
+    void add(const AtlasSource& source, const sf::Image& image);
+
+    // Loads a manifest entry's PNG from disk (scaled ones through the ImageScaler cache) and adds it.
+    // Returns false if the file can't be read.
+    bool addFile(const AtlasSource& source);
+
+    // Packs everything added so far into pages. Returns false if a sprite doesn't fit on a page.
+    bool pack();
+
+    // Returns the packed page images (valid after pack()).
+    const std::vector<sf::Image>& getPages() const { return pages; }
+
+    // Returns where each sprite id was placed (valid after pack()).
+    const std::map<std::string, AtlasRegion>& getRegions() const { return regions; }
+
+    // Writes the pages as <dir>/<name>_<n>.png and the UV table as <dir>/<name>.json.
+    bool save(const std::string& dir, const std::string& name) const;
+
+    // Returns the sprites that go into the named atlas ("room", "closeup" or "aquarium").
+    static std::vector<AtlasSource> manifest(const std::string& atlasName);
+
+    // Returns the names of all atlases listed in the manifest.
+    static std::vector<std::string> atlasNames();
+
+private:
+    // Adds an entry whose image is already at its final size.
+    void addScaled(const AtlasSource& source, const sf::Image& image);
+
+    // A layer waiting for pack() to match it against its bases.
+    struct Layer {
+        std::string id;                      // Sprite id.
+        sf::Image image;                 // Full-size image (base + what the layer adds).
+        std::vector<std::string> bases;  // Candidate base sprite ids.
+    };
+
+    // Turns every layer into a cropped difference image against its best base and queues it for packing.
+    void resolveLayers();
+
+    unsigned pageSize;                          // Maximum page width/height in pixels.
+    unsigned padding;                           // Empty pixels kept around each sprite.
+    std::vector<std::pair<std::string, sf::Image>> images; // Sprites waiting to be packed.
+    std::vector<sf::Image> pages;               // Packed page images.
+    std::map<std::string, AtlasRegion> regions; // Packed location of every sprite.
+    std::vector<Layer> layers;                  // Layers waiting to be resolved.
+    std::map<std::string, std::pair<std::string, sf::Vector2i>> layerPlacement; // Base id and offset of each resolved layer.
+};
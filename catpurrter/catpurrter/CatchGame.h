@@ -3,6 +3,9 @@
 #include <deque>
 #include <vector>
 #include "MiniGameBase.h"
+#include "TextCache.h"
+#include "MiniGameScreens.h"
+#include "CatchSim.h"
 #include "Player.h"
 #include "GameManager.h"
 
@@ -17,7 +20,7 @@ enum class CatchGameState {
 
 // CatchGame implements the falling-object "catch or dodge" mini-game.
 // Player moves left/right to catch good drops and avoid bad ones.
-// Handles all game logic, UI, scoring, and coin rewards.
+// The rules live in a CatchSim; this adds the menus, drawing and coin rewards.
 class CatchGame : public MiniGameBase {
 public:
     // Constructs the CatchGame, using the font for UI and referencing player/game manager.
@@ -27,21 +30,15 @@ public:
     void init() override;
 
     // Updates game logic: moves player, spawns and moves drops, handles scoring/lives, etc.
-    // dt: time elapsed since last frame (seconds)
-    void update(float dt) override;
+    // dt: length of one simulation step (seconds)
+    void update(float dt, const InputState& input) override;
 
     // Draws the current screen (menu, game, pause, etc) to the window.
-    void render(sf::RenderWindow& window) override;
+    void render(DrawList& window, float alpha) override;
 
     // Handles keyboard input for left/right movement, menus, pausing, etc.
     void handleInput(sf::Keyboard::Key key) override;
 
-    // Returns true if the player requested to close/exit the mini-game.
-    bool shouldClose() const override { return closeRequested; }
-
-    // Resets the close flag (so view won't immediately close on next open).
-    void resetCloseFlag() override { closeRequested = false; }
-
     // Returns how many coins were earned in the last completed play session.
     int getCoinsEarned() const override { return coinsEarned; }
 
@@ -51,41 +48,25 @@ public:
 private:
     // Core references
     const sf::Font& font;        // Reference to game's font for UI text
+    TextCache texts;             // Menu, score/lives and popup text, laid out once
     Player& player;              // Reference to player data (coins, etc)
     GameManager& gameManager;    // Reference to game manager (if needed)
 
     // State
     CatchGameState state = CatchGameState::MainMenu; // Current menu/screen
-    int menuIndex = 0;        // Which option is selected on main menu
-    int pauseIndex = 0;       // Which option is selected on pause menu
-    int gameOverIndex = 0;    // Which option is selected on game over menu
-    bool closeRequested = false; // True if ESC/exit pressed
+    MiniGameScreens screens;  // Main menu, instructions, pause and game over widgets (they track the selections)
     bool coinsAdded = false;     // True if coins have been awarded this session
 
     // Game logic
-    int score = 0;           // Player's score this session
+    CatchSim sim;            // Paddle, drops, score and lives
     int coinsEarned = 0;     // Coins earned this session
-    int lives = 2;           // Lives remaining
-    float spawnTimer = 0.f;  // Time accumulator for spawning drops
-    float spawnDelay = 1.0f; // Time between drop spawns (decreases with score)
-    float fallSpeed = 180.f; // How fast drops fall (increases with score)
-
-    // Drop represents one falling object (good or bad)
-    struct Drop {
-        sf::RectangleShape shape; // Rectangle for drawing and collision
-        bool good;                // True if catching is good, false = bad drop
-    };
-    std::vector<Drop> drops;      // All drops currently falling
-
-    // Player
-    sf::RectangleShape playerRect; // The player's paddle/box
 
     // Utility methods for game/menu logic and UI
     void resetGame();                      // Resets the game state for a new play session
-    void spawnDrop();                      // Spawns a new falling object
-    void drawMenu(sf::RenderWindow& window);          // Draws main menu screen
-    void drawGame(sf::RenderWindow& window);          // Draws the game area, player, drops, score, lives
-    void drawPause(sf::RenderWindow& window);         // Draws pause overlay
-    void drawInstructions(sf::RenderWindow& window);  // Draws how-to-play instructions
-    void drawGameOver(sf::RenderWindow& window);      // Draws game over/results screen
+    void buildScreens();                   // Describes the menus and popups and lays them out
+    void drawMenu(DrawList& window);          // Draws main menu screen
+    void drawGame(DrawList& window, float alpha); // Draws the game area, player, drops, score, lives
+    void drawPause(DrawList& window);         // Draws pause overlay
+    void drawInstructions(DrawList& window);  // Draws how-to-play instructions
+    void drawGameOver(DrawList& window);      // Draws game over/results screen
 };
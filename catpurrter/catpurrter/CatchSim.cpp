@@ -0,0 +1,90 @@
+#include "CatchSim.h"
+#include <algorithm>
+
+namespace {
+    // Paddle speed (pixels/sec).
+    const float PADDLE_SPEED = 1000.f;
+}
+
+void CatchSim::reset(unsigned seed) {
+    rng.seed(seed);
+    drops.clear();
+    paddle = { 400.f, PADDLE_Y };
+    paddlePrevious = paddle;
+    score = 0;
+    lives = 2;
+    spawnTimer = 0.f;
+    spawnDelay = 1.3f;
+    fallSpeed = 180.f;
+}
+
+void CatchSim::hold() {
+    paddlePrevious = paddle;
+    for (auto& drop : drops)
+        drop.previous = drop.position;
+}
+
+sf::FloatRect CatchSim::box(sf::Vector2f position, float width, float height) {
+    return { position.x - width / 2.f, position.y - height / 2.f, width, height };
+}
+
+void CatchSim::spawnDrop() {
+    std::uniform_real_distribution<float> xpos(LEFT, RIGHT);
+    std::uniform_int_distribution<int> kind(0, 3);
+
+    Drop drop;
+    drop.position = { xpos(rng), SPAWN_Y };
+    drop.previous = drop.position;
+    drop.kind = kind(rng);
+    drops.push_back(drop);
+}
+
+void CatchSim::step(float dt, const InputState& input) {
+    hold();
+    if (isOver())
+        return;
+
+    if (input.isHeld(Action::MoveLeft))
+        paddle.x = std::max(LEFT, paddle.x - PADDLE_SPEED * dt);
+    if (input.isHeld(Action::MoveRight))
+        paddle.x = std::min(RIGHT, paddle.x + PADDLE_SPEED * dt);
+
+    // Spawning drops
+    spawnTimer += dt;
+    if (spawnTimer >= spawnDelay) {
+        spawnTimer -= spawnDelay;
+        spawnDrop();
+    }
+
+    // Drops movement/collision
+    for (auto& drop : drops)
+        drop.position.y += fallSpeed * dt;
+
+    const sf::FloatRect paddleBox = box(paddle, PADDLE_WIDTH, PADDLE_HEIGHT);
+    auto it = drops.begin();
+    while (it != drops.end()) {
+        if (box(it->position, DROP_SIZE, DROP_SIZE).intersects(paddleBox)) {
+            if (it->isGood()) {
+                score++;
+                if (score % 7 == 0 && fallSpeed < 350.f)
+                    fallSpeed += 10.f;
+            }
+            else {
+                lives--;
+                score = std::max(0, score - 1);
+            }
+            it = drops.erase(it);
+        }
+        else if (it->position.y > FLOOR_Y) {
+            if (it->isGood())
+                lives--;
+            it = drops.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    spawnDelay = std::max(1.3f - score * 0.021f, 0.25f);
+    fallSpeed = std::min(fallSpeed, 400.f);
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include "Simulation.h"
+#include <random>
+#include <vector>
+
+// CatchSim is the Catch game's rules: a paddle sliding along the bottom of the play area and drops falling
+// from the top. Good drops caught score a point and bad ones cost a life (and a point); a good drop missed
+// costs a life too. Drops come faster and fall quicker as the score rises; the round ends below zero lives.
+// Positions are centres, so the game draws the shapes around them.
+class CatchSim : public Simulation {
+public:
+    static constexpr float LEFT = 120.f;          // Leftmost paddle centre / drop spawn x.
+    static constexpr float RIGHT = 680.f;         // Rightmost paddle centre / drop spawn x.
+    static constexpr float PADDLE_Y = 530.f;      // Paddle centre height.
+    static constexpr float SPAWN_Y = 80.f;        // Drops start here.
+    static constexpr float FLOOR_Y = 590.f;       // Drops below this are missed.
+    static constexpr float PADDLE_WIDTH = 70.f;   // Paddle size.
+    static constexpr float PADDLE_HEIGHT = 25.f;
+    static constexpr float DROP_SIZE = 30.f;      // Drop side length.
+
+    // A falling drop. Kinds 0-1 are good, 2-3 bad (they only differ in colour).
+    struct Drop {
+        sf::Vector2f position; // Centre.
+        sf::Vector2f previous; // Centre after the previous step (drawn interpolated).
+        int kind = 0;          // Look and whether it's good.
+
+        // Returns true if catching the drop scores.
+        bool isGood() const { return kind < 2; }
+    };
+
+    // Centres the paddle, clears the drops and restores the starting lives, speed and spawn rate.
+    void reset(unsigned seed) override;
+
+    // Moves the paddle with MoveLeft/MoveRight, spawns and drops the drops, and scores what they hit.
+    void step(float dt, const InputState& input) override;
+
+    // Keeps everything where it is (while paused), so interpolated frames stand still.
+    void hold();
+
+    // Returns true once the last life is gone.
+    bool isOver() const override { return lives < 0; }
+
+    // Returns the score (never negative).
+    int getScore() const override { return score; }
+
+    // Returns the lives left.
+    int getLives() const { return lives; }
+
+    // Returns the paddle's centre now and after the previous step.
+    sf::Vector2f getPaddle() const { return paddle; }
+    sf::Vector2f getPaddlePrevious() const { return paddlePrevious; }
+
+    // Returns the drops in the air.
+    const std::vector<Drop>& getDrops() const { return drops; }
+
+private:
+    // Adds a drop of a random kind at a random x along the top.
+    void spawnDrop();
+
+    // Returns the box of something of the given size centred on position.
+    static sf::FloatRect box(sf::Vector2f position, float width, float height);
+
+    std::mt19937 rng;             // Drop positions and kinds.
+    std::vector<Drop> drops;      // Drops in the air.
+    sf::Vector2f paddle;          // Paddle centre.
+    sf::Vector2f paddlePrevious;  // Paddle centre after the previous step.
+    int score = 0;                // Good drops caught minus bad ones (not below 0).
+    int lives = 2;                // Lives left; the round ends below 0.
+    float spawnTimer = 0.f;       // Time since the last drop.
+    float spawnDelay = 1.3f;      // Time between drops (shrinks with the score).
+    float fallSpeed = 180.f;      // How fast drops fall (grows with the score).
+};
@@ -1,4 +1,6 @@
 #include "Computer.h"
+#include "AssetCache.h"
+#include "MiniGameRegistry.h"
 #include <iostream>
 #include <cmath>
 
@@ -6,15 +8,18 @@ Computer::Computer(sf::Font& fontRef, Player& playerRef)
     : font(fontRef), playerData(playerRef) {
 }
 
+AssetList Computer::requiredAssets(const Player&) {
+    return { { "assets/graphics/desktop.png" }, {} };
+}
+
 void Computer::init() {
-    if (!desktopBgTexture.loadFromFile("assets/graphics/desktop.png")) {
-        std::cout << "Failed to load desktop background!\n";
-    }
-    desktopBgSprite.setTexture(desktopBgTexture);
+    desktopBgTexture = AssetCache::instance().getTexture("assets/graphics/desktop.png");
+    if (desktopBgTexture)
+        desktopBgSprite.setTexture(*desktopBgTexture);
     icons.clear();
     selectedIndex = 0;
     selected = ComputerSelection::None;
-    closeRequested = false;
+    iconsVersion = playerData.inventoryVersion;
 
     DesktopIcon shopIcon;
     shopIcon.id = "shop";
@@ -26,10 +31,7 @@ void Computer::init() {
     for (const auto& mg : playerData.ownedMiniGames) {
         DesktopIcon icon;
         icon.id = mg;
-        if (mg == "snake") icon.label = "Snake";
-        else if (mg == "catch") icon.label = "Catch Game";
-        else if (mg == "dodge") icon.label = "Dodge Game";
-        else icon.label = mg; 
+        icon.label = MiniGameRegistry::instance().getTitle(mg);
         icon.rect.setSize({ 70.f, 70.f });
         icon.rect.setFillColor(sf::Color(120, 180, 120));
         icons.push_back(icon);
@@ -40,30 +42,34 @@ void Computer::init() {
 void Computer::update() {
   }
 
-void Computer::render(sf::RenderWindow& window) {
-    window.draw(desktopBgSprite);
-
+sf::Vector2f Computer::iconPosition(size_t index) const {
     float startX = 140.f, startY = 130.f;
     float gapX = 145.f, gapY = 120.f;
-    int perRow = iconsPerRow;
-    for (size_t i = 0; i < icons.size(); ++i) {
-        int row = i / perRow;
-        int col = i % perRow;
+    int row = static_cast<int>(index) / iconsPerRow;
+    int col = static_cast<int>(index) % iconsPerRow;
+    return { startX + col * gapX, startY + row * gapY };
+}
 
-        float x = startX + col * gapX;
-        float y = startY + row * gapY;
+void Computer::render(DrawList& target) {
+    target.draw(desktopBgSprite);
 
+    for (size_t i = 0; i < icons.size(); ++i) {
         auto rect = icons[i].rect;
-        rect.setPosition(x, y);
+        rect.setPosition(iconPosition(i));
         rect.setOutlineColor(i == selectedIndex ? sf::Color::Yellow : sf::Color(40, 40, 40));
         rect.setOutlineThickness(i == selectedIndex ? 4.f : 2.f);
-        window.draw(rect);
+        target.draw(rect);
+    }
+}
 
-        sf::Text label(icons[i].label, font, 24);
+void Computer::renderUi(DrawList& window) {
+    for (size_t i = 0; i < icons.size(); ++i) {
+        sf::Vector2f pos = iconPosition(i);
+        sf::Text& label = texts.get(icons[i].label, font, 24);
         label.setFillColor(sf::Color::White);
         sf::FloatRect bounds = label.getLocalBounds();
         label.setOrigin(bounds.width / 2.f, 0);
-        label.setPosition(x + 35.f, y + 75.f);
+        label.setPosition(pos.x + 35.f, pos.y + 75.f);
         window.draw(label);
     }
 }
@@ -75,7 +81,7 @@ void Computer::handleInput(sf::Keyboard::Key key) {
     int col = selectedIndex % perRow;
 
     if (key == sf::Keyboard::Escape) {
-        closeRequested = true;
+        requestClose();
         return;
     }
     if (key == sf::Keyboard::Left || key == sf::Keyboard::A) {
@@ -103,12 +109,11 @@ void Computer::handleInput(sf::Keyboard::Key key) {
     }
 }
 
-bool Computer::shouldClose() const {
-    return closeRequested;
-}
-
-void Computer::resetCloseFlag() {
-    closeRequested = false;
+void Computer::onEnter() {
+    selected = ComputerSelection::None;
+    selectedMiniGame.clear();
+    if (iconsVersion != playerData.inventoryVersion)
+        init();
 }
 
 ComputerSelection Computer::getSelectedOption() const {
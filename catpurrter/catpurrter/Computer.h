@@ -1,8 +1,13 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "DrawList.h"
 #include <vector>
 #include <string>
+#include <memory>
 #include "Player.h"
+#include "AssetCache.h"
+#include "TextCache.h"
+#include "Scene.h"
 
 // DesktopIcon represents an icon on the "computer desktop" view.
 // Each icon can be the shop or a mini-game the player owns.
@@ -23,7 +28,7 @@ enum class ComputerSelection {
 // Computer shows a "desktop" screen with icons for Shop and unlocked mini-games.
 // Lets the player select which app (shop/minigame) to open.
 // Handles rendering, input navigation, and selection.
-class Computer {
+class Computer : public Scene {
 public:
     // Constructs the Computer view with the game's font and player data.
     Computer(const sf::Font& font);
@@ -32,20 +37,23 @@ public:
     // Initializes the desktop: loads background, sets up icons, resets selection state.
     void init();
 
+    // Returns the textures and atlases init() uses, so they can be prefetched before the view opens.
+    static AssetList requiredAssets(const Player& player);
+
     // Updates selection or animation (not used in current implementation).
     void update();
 
-    // Draws the desktop background and all icons to the window.
-    void render(sf::RenderWindow& window);
+    // Draws the desktop background and the icons (the world pass, may be drawn at reduced resolution).
+    void render(DrawList& target);
+
+    // Draws the icon labels on top at native resolution.
+    void renderUi(DrawList& target);
 
     // Handles keyboard input for icon navigation and selection (arrows/WASD + Enter + ESC).
     void handleInput(sf::Keyboard::Key key);
 
-    // Returns true if the player pressed ESC to close the computer view.
-    bool shouldClose() const;
-
-    // Resets the close flag so this view won't immediately close when reopened.
-    void resetCloseFlag();
+    // Forgets the last selection, and rebuilds the icons if a minigame was bought since init().
+    void onEnter() override;
 
     // Returns what the player has selected (Shop, MiniGame, None, etc.).
     ComputerSelection getSelectedOption() const;
@@ -57,17 +65,21 @@ public:
     void clearSelectedMiniGame();
 
 private:
-    sf::Texture desktopBgTexture;      // Texture for desktop background image.
+    std::shared_ptr<sf::Texture> desktopBgTexture; // Texture for desktop background image.
     sf::Sprite desktopBgSprite;        // Sprite for desktop background.
 
     const sf::Font& font;              // Reference to game's font.
+    TextCache texts;                   // Icon labels, laid out once.
     Player& playerData;                // Reference to player data (to show owned games).
 
     std::vector<DesktopIcon> icons;    // List of desktop icons (shop + owned mini-games).
     int iconsPerRow = 4;               // How many icons are shown per row.
     int selectedIndex = 0;             // Index of the currently highlighted icon.
+    unsigned iconsVersion = 0;         // Player::inventoryVersion the icons were built for.
+
+    // Returns where the icon at index sits in the grid.
+    sf::Vector2f iconPosition(size_t index) const;
 
-    bool closeRequested = false;       // True if player pressed ESC to exit.
     ComputerSelection selected = ComputerSelection::None;  // What the player has currently selected.
     std::string selectedMiniGame;      // If selected, which mini-game id.
 };
@@ -0,0 +1,110 @@
+#include "DodgeSim.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Player speed (pixels/sec).
+    const float PLAYER_SPEED = 370.f;
+
+    // Drops this far past the arena edges count as dodged.
+    const float EXIT_MARGIN = 10.f;
+}
+
+void DodgeSim::reset(unsigned seed) {
+    rng.seed(seed);
+    drops.clear();
+    player = { 400.f, 340.f };
+    playerPrevious = player;
+    score = 0;
+    coinsEarned = 0;
+    lives = 2;
+    spawnTimer = 0.f;
+    spawnDelay = 1.0f;
+    dropSpeed = 220.f;
+}
+
+void DodgeSim::hold() {
+    playerPrevious = player;
+    for (auto& drop : drops)
+        drop.previous = drop.position;
+}
+
+void DodgeSim::spawnDrop() {
+    std::uniform_int_distribution<int> edgeDist(0, 3);
+    std::uniform_real_distribution<float> wX(LEFT, RIGHT);
+    std::uniform_real_distribution<float> hY(TOP, BOTTOM);
+
+    Drop drop;
+    const int edge = edgeDist(rng);
+    if (edge == 0) { // top
+        drop.position = { wX(rng), TOP };
+        drop.velocity = { 0.f, dropSpeed };
+    }
+    else if (edge == 1) { // right
+        drop.position = { RIGHT, hY(rng) };
+        drop.velocity = { -dropSpeed, 0.f };
+    }
+    else if (edge == 2) { // bottom
+        drop.position = { wX(rng), BOTTOM };
+        drop.velocity = { 0.f, -dropSpeed };
+    }
+    else { // left
+        drop.position = { LEFT, hY(rng) };
+        drop.velocity = { dropSpeed, 0.f };
+    }
+    drop.previous = drop.position;
+    drops.push_back(drop);
+}
+
+void DodgeSim::step(float dt, const InputState& input) {
+    hold();
+    if (isOver())
+        return;
+
+    sf::Vector2f move(0, 0);
+    if (input.isHeld(Action::MoveLeft)) move.x -= 1.f;
+    if (input.isHeld(Action::MoveRight)) move.x += 1.f;
+    if (input.isHeld(Action::MoveUp)) move.y -= 1.f;
+    if (input.isHeld(Action::MoveDown)) move.y += 1.f;
+    if (move.x != 0 || move.y != 0) {
+        // Diagonals aren't faster
+        move /= std::sqrt(move.x * move.x + move.y * move.y);
+        player += move * PLAYER_SPEED * dt;
+    }
+    player.x = std::clamp(player.x, LEFT, RIGHT);
+    player.y = std::clamp(player.y, TOP, BOTTOM);
+
+    // Spawning drops
+    spawnTimer += dt;
+    if (spawnTimer >= spawnDelay) {
+        spawnTimer -= spawnDelay;
+        spawnDrop();
+    }
+
+    for (auto& drop : drops)
+        drop.position += drop.velocity * dt;
+
+    const sf::FloatRect playerBox(player.x - PLAYER_SIZE / 2.f, player.y - PLAYER_SIZE / 2.f, PLAYER_SIZE, PLAYER_SIZE);
+    auto it = drops.begin();
+    while (it != drops.end()) {
+        const sf::Vector2f p = it->position;
+        const bool gone = p.x < LEFT - EXIT_MARGIN || p.x > RIGHT + EXIT_MARGIN || p.y < TOP - EXIT_MARGIN || p.y > BOTTOM + EXIT_MARGIN;
+        if (gone) {
+            // Out of the arena: dodged
+            score++;
+            if (score % 4 == 0) coinsEarned++;
+            if (score % 7 == 0 && dropSpeed < 400.f) dropSpeed += 16.f;
+            it = drops.erase(it);
+        }
+        else if (sf::FloatRect(p.x - DROP_RADIUS, p.y - DROP_RADIUS, 2.f * DROP_RADIUS, 2.f * DROP_RADIUS).intersects(playerBox)) {
+            lives--;
+            it = drops.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    // Difficulty: decrease spawn delay as score increases
+    spawnDelay = std::max(1.0f - 0.019f * score, 0.17f);
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include "Simulation.h"
+#include <random>
+#include <vector>
+
+// DodgeSim is the Dodge game's rules: a square the player steers around the arena while drops fly in
+// from the edges. Every drop that leaves the arena scores a point (and every fourth point a coin); every
+// drop that hits costs a life. Drops come faster and more often as the score rises; the round ends below
+// zero lives. Positions are centres, so the game draws the shapes around them.
+class DodgeSim : public Simulation {
+public:
+    static constexpr float LEFT = 120.f;        // Arena edges (the player's centre stays inside).
+    static constexpr float RIGHT = 680.f;
+    static constexpr float TOP = 80.f;
+    static constexpr float BOTTOM = 600.f;
+    static constexpr float PLAYER_SIZE = 40.f;  // Player side length.
+    static constexpr float DROP_RADIUS = 18.f;  // Drop radius.
+
+    // A drop crossing the arena.
+    struct Drop {
+        sf::Vector2f position; // Centre.
+        sf::Vector2f previous; // Centre after the previous step (drawn interpolated).
+        sf::Vector2f velocity; // Pixels per second.
+    };
+
+    // Centres the player, clears the drops and restores the starting lives, speed and spawn rate.
+    void reset(unsigned seed) override;
+
+    // Steers the player with the move actions, spawns and moves the drops, and scores them.
+    void step(float dt, const InputState& input) override;
+
+    // Keeps everything where it is (while paused), so interpolated frames stand still.
+    void hold();
+
+    // Returns true once the last life is gone.
+    bool isOver() const override { return lives < 0; }
+
+    // Returns the number of drops dodged.
+    int getScore() const override { return score; }
+
+    // Returns the coins earned (one per 4 points).
+    int getCoinsEarned() const { return coinsEarned; }
+
+    // Returns the lives left.
+    int getLives() const { return lives; }
+
+    // Returns the player's centre now and after the previous step.
+    sf::Vector2f getPlayer() const { return player; }
+    sf::Vector2f getPlayerPrevious() const { return playerPrevious; }
+
+    // Returns the drops in the arena.
+    const std::vector<Drop>& getDrops() const { return drops; }
+
+private:
+    // Adds a drop on a random edge, heading across.
+    void spawnDrop();
+
+    std::mt19937 rng;             // Drop edges and positions.
+    std::vector<Drop> drops;      // Drops in the arena.
+    sf::Vector2f player;          // Player centre.
+    sf::Vector2f playerPrevious;  // Player centre after the previous step.
+    int score = 0;                // Drops dodged.
+    int coinsEarned = 0;          // One per 4 points.
+    int lives = 2;                // Lives left; the round ends below 0.
+    float spawnTimer = 0.f;       // Time since the last drop.
+    float spawnDelay = 1.f;       // Time between drops (shrinks with the score).
+    float dropSpeed = 220.f;      // Speed of new drops (grows with the score).
+};
@@ -0,0 +1,213 @@
+#include "DrawList.h"
+#include <algorithm>
+#include <iostream>
+
+DrawList::DrawList(sf::Vector2f logicalSize)
+    : view(sf::FloatRect(0.f, 0.f, logicalSize.x, logicalSize.y)) {
+}
+
+void DrawList::reset() {
+    for (auto& layerCommands : commands)
+        layerCommands.clear();
+    openParts.clear();
+    vertices.clear();
+    runs.clear();
+    clears.clear();
+    parts.clear();
+    textCount = 0;
+    rectangleCount = 0;
+    circleCount = 0;
+    layer = Layer::World;
+}
+
+void DrawList::setLayer(Layer newLayer) {
+    layer = newLayer;
+}
+
+void DrawList::push(Kind kind, std::size_t index) {
+    commands[static_cast<int>(layer)].push_back({ kind, index });
+}
+
+void DrawList::clear(sf::Color color) {
+    clears.push_back(color);
+    push(Kind::Clear, clears.size() - 1);
+}
+
+void DrawList::draw(const sf::Sprite& sprite) {
+    // Like sf::Sprite, a sprite without a texture draws nothing
+    if (!sprite.getTexture())
+        return;
+
+    const sf::IntRect rect = sprite.getTextureRect();
+    const sf::FloatRect bounds = sprite.getLocalBounds();
+    const sf::Color color = sprite.getColor();
+    const float left = static_cast<float>(rect.left);
+    const float top = static_cast<float>(rect.top);
+    const float right = left + static_cast<float>(rect.width);
+    const float bottom = top + static_cast<float>(rect.height);
+
+    const sf::Vertex quad[6] = {
+        sf::Vertex({ 0.f, 0.f }, color, { left, top }),
+        sf::Vertex({ bounds.width, 0.f }, color, { right, top }),
+        sf::Vertex({ 0.f, bounds.height }, color, { left, bottom }),
+        sf::Vertex({ 0.f, bounds.height }, color, { left, bottom }),
+        sf::Vertex({ bounds.width, 0.f }, color, { right, top }),
+        sf::Vertex({ bounds.width, bounds.height }, color, { right, bottom })
+    };
+    drawTriangles(sprite.getTexture(), quad, 6, sprite.getTransform());
+}
+
+void DrawList::draw(const sf::Text& text) {
+    // Lays the glyphs out here, on the game thread: the render thread must not touch the font
+    text.getLocalBounds();
+    if (textCount == texts.size())
+        texts.push_back(text);
+    else
+        texts[textCount] = text;
+    push(Kind::Text, textCount++);
+}
+
+void DrawList::draw(const sf::RectangleShape& shape) {
+    if (rectangleCount == rectangles.size())
+        rectangles.push_back(shape);
+    else
+        rectangles[rectangleCount] = shape;
+    push(Kind::Rectangle, rectangleCount++);
+}
+
+void DrawList::draw(const sf::CircleShape& shape) {
+    if (circleCount == circles.size())
+        circles.push_back(shape);
+    else
+        circles[circleCount] = shape;
+    push(Kind::Circle, circleCount++);
+}
+
+void DrawList::drawTriangles(const sf::Texture* texture, const sf::Vertex* triangles, std::size_t count,
+    const sf::Transform& transform) {
+    if (count == 0)
+        return;
+
+    // Extend the layer's last run if it's on the same texture and its vertices end the pool
+    std::vector<Command>& layerCommands = commands[static_cast<int>(layer)];
+    bool extend = !layerCommands.empty() && layerCommands.back().kind == Kind::Triangles;
+    if (extend) {
+        const Run& last = runs[layerCommands.back().index];
+        extend = last.texture == texture && last.first + last.count == vertices.size();
+    }
+    if (!extend) {
+        runs.push_back({ texture, vertices.size(), 0 });
+        push(Kind::Triangles, runs.size() - 1);
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        sf::Vertex vertex = triangles[i];
+        vertex.position = transform.transformPoint(vertex.position);
+        vertices.push_back(vertex);
+    }
+    runs[layerCommands.back().index].count += count;
+}
+
+void DrawList::beginCached(const void* key, unsigned version) {
+    // Until it is ended the part is empty: it ends right after its own command
+    push(Kind::CachedPart, parts.size());
+    const std::size_t end = commands[static_cast<int>(layer)].size();
+    parts.push_back({ key, version, layer, end });
+    openParts.push_back(parts.size() - 1);
+}
+
+void DrawList::endCached() {
+    if (openParts.empty())
+        return;
+    Part& part = parts[openParts.back()];
+    part.end = commands[static_cast<int>(part.layer)].size();
+    openParts.pop_back();
+}
+
+void DrawList::finish() {
+    if (!openParts.empty())
+        std::cout << "DrawList: " << openParts.size() << " cacheable part(s) not ended, ending them with the frame\n";
+    while (!openParts.empty())
+        endCached();
+}
+
+void DrawList::execute(Layer which, sf::RenderTarget& target, CacheMap& caches) const {
+    executeRange(which, 0, commands[static_cast<int>(which)].size(), target, caches);
+}
+
+void DrawList::executeRange(Layer which, std::size_t first, std::size_t last, sf::RenderTarget& target, CacheMap& caches) const {
+    const std::vector<Command>& layerCommands = commands[static_cast<int>(which)];
+    for (std::size_t i = first; i < last; ++i) {
+        const Command& command = layerCommands[i];
+        switch (command.kind) {
+        case Kind::Clear:
+            target.clear(clears[command.index]);
+            break;
+        case Kind::Triangles: {
+            const Run& run = runs[command.index];
+            sf::RenderStates states;
+            states.texture = run.texture;
+            target.draw(&vertices[run.first], run.count, sf::PrimitiveType::Triangles, states);
+            break;
+        }
+        case Kind::Text:
+            target.draw(texts[command.index]);
+            break;
+        case Kind::Rectangle:
+            target.draw(rectangles[command.index]);
+            break;
+        case Kind::Circle:
+            target.draw(circles[command.index]);
+            break;
+        case Kind::CachedPart:
+            executePart(which, i, target, caches);
+            // Carry on after the part, never going back (even for a part that ended before it began)
+            i = std::max(i + 1, std::min(parts[command.index].end, last)) - 1;
+            break;
+        }
+    }
+}
+
+void DrawList::executePart(Layer which, std::size_t at, sf::RenderTarget& target, CacheMap& caches) const {
+    const Part& part = parts[commands[static_cast<int>(which)][at].index];
+    CachedPart& cache = caches[part.key];
+    cache.used = true;
+
+    // Baked at the target's pixel size, over the whole logical view
+    const sf::Vector2u size = target.getSize();
+    if (!cache.failed && (!cache.baked || cache.version != part.version || cache.texture.getSize() != size)) {
+        if (cache.texture.getSize() == size || cache.texture.create(size.x, size.y)) {
+            cache.texture.setView(sf::View(view.getCenter(), view.getSize()));
+            cache.texture.clear(sf::Color::Transparent);
+            executeRange(which, at + 1, part.end, cache.texture, caches);
+            cache.texture.display();
+            cache.version = part.version;
+            cache.baked = true;
+        }
+        else {
+            std::cout << "Couldn't create a render texture for a cached layer, drawing it every frame\n";
+            cache.failed = true;
+        }
+    }
+
+    if (cache.failed) {
+        executeRange(which, at + 1, part.end, target, caches);
+        return;
+    }
+    sf::Sprite baked(cache.texture.getTexture());
+    baked.setScale(view.getSize().x / size.x, view.getSize().y / size.y);
+    baked.setPosition(view.getCenter() - view.getSize() / 2.f);
+    target.draw(baked);
+}
+
+void DrawList::pruneCaches(CacheMap& caches) {
+    for (auto it = caches.begin(); it != caches.end();) {
+        if (!it->second.used) {
+            it = caches.erase(it);
+        }
+        else {
+            it->second.used = false;
+            ++it;
+        }
+    }
+}
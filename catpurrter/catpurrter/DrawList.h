@@ -0,0 +1,135 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <vector>
+
+// DrawList is one recorded frame: what the views asked to draw, copied into plain data (vertices with
+// their texture and transform, and copies of texts and shapes) so the render thread can draw it while
+// the game already simulates the next frame. Views record into it with the same draw() calls they'd
+// use on a window. Nothing in a list points back into the views, only to textures and the font,
+// which the AssetCache keeps alive until the renderer is idle (see Renderer::waitIdle).
+//
+// A frame has two layers: the world (pictures, drawn through the ResolutionScaler) and the UI on top.
+// Part of a layer can be marked cacheable (beginCached/endCached): the render thread bakes it into a
+// texture and reuses that until the part's version changes, like the room's walls and furniture.
+class DrawList {
+public:
+    // Which pass draw calls go to.
+    enum class Layer {
+        World, // Scaled world pass.
+        Ui     // Native resolution pass on top.
+    };
+
+    // A baked cacheable part, kept by the render thread between frames.
+    struct CachedPart {
+        sf::RenderTexture texture; // The part drawn at the target's size.
+        unsigned version = 0;      // Version the texture was baked for.
+        bool baked = false;        // texture holds a bake.
+        bool failed = false;       // The texture couldn't be created; the part is drawn directly.
+        bool used = false;         // Drawn since the last prune (see pruneCaches).
+    };
+    using CacheMap = std::map<const void*, CachedPart>;
+
+    // Creates an empty list for the given logical size (the coordinates views draw in).
+    explicit DrawList(sf::Vector2f logicalSize = { 800.f, 600.f });
+
+    // Empties both layers (keeping capacity) and goes back to the world layer.
+    void reset();
+
+    // Sends the following draw calls to a layer.
+    void setLayer(Layer layer);
+
+    // Returns true if anything was recorded into the layer.
+    bool hasLayer(Layer layer) const { return !commands[static_cast<int>(layer)].empty(); }
+
+    // Returns the logical view (views read its size to centre things).
+    const sf::View& getView() const { return view; }
+
+    // Fills the whole target with a colour.
+    void clear(sf::Color color = sf::Color::Black);
+
+    // Records a sprite, text or shape as it is now.
+    void draw(const sf::Sprite& sprite);
+    void draw(const sf::Text& text);
+    void draw(const sf::RectangleShape& shape);
+    void draw(const sf::CircleShape& shape);
+
+    // Records triangles sampling texture (nullptr = untextured), placed with transform.
+    // Consecutive calls on the same texture are merged into one draw.
+    void drawTriangles(const sf::Texture* texture, const sf::Vertex* vertices, std::size_t count,
+        const sf::Transform& transform = sf::Transform::Identity);
+
+    // Starts a cacheable part identified by key; its content only has to change when version does.
+    void beginCached(const void* key, unsigned version);
+
+    // Ends the cacheable part started last.
+    void endCached();
+
+    // Ends the cacheable parts still open, so the list can be drawn (the Renderer does this on submit).
+    void finish();
+
+    // Draws one layer into target (render thread). Cacheable parts are baked into or drawn from caches.
+    void execute(Layer layer, sf::RenderTarget& target, CacheMap& caches) const;
+
+    // Drops the caches of parts no frame has drawn since the last call (e.g. of a room that was closed).
+    static void pruneCaches(CacheMap& caches);
+
+private:
+    // What a command draws.
+    enum class Kind {
+        Clear,       // clears[index]
+        Triangles,   // runs[index]
+        Text,        // texts[index]
+        Rectangle,   // rectangles[index]
+        Circle,      // circles[index]
+        CachedPart   // parts[index]
+    };
+
+    // One recorded draw.
+    struct Command {
+        Kind kind;          // What it draws.
+        std::size_t index;  // Where its data is, in the pool for its kind.
+    };
+
+    // Triangles sharing a texture (already transformed).
+    struct Run {
+        const sf::Texture* texture = nullptr; // Texture (nullptr = untextured).
+        std::size_t first = 0;                // First vertex in vertices.
+        std::size_t count = 0;                // Number of vertices.
+    };
+
+    // A cacheable stretch of a layer.
+    struct Part {
+        const void* key = nullptr; // Identifies the part between frames.
+        unsigned version = 0;      // Changes whenever the content does.
+        Layer layer = Layer::World; // Layer the part is in.
+        std::size_t end = 0;       // Index of the first command after the part (set when it ends).
+    };
+
+    // Appends a command to the current layer.
+    void push(Kind kind, std::size_t index);
+
+    // Draws commands [first, last) of a layer.
+    void executeRange(Layer layer, std::size_t first, std::size_t last, sf::RenderTarget& target, CacheMap& caches) const;
+
+    // Draws a cacheable part, baking it first if its cache is missing or stale.
+    void executePart(Layer layer, std::size_t at, sf::RenderTarget& target, CacheMap& caches) const;
+
+    sf::View view;                                // Logical view.
+    Layer layer = Layer::World;                   // Layer being recorded.
+    std::vector<Command> commands[2];             // Commands per layer, in order.
+    std::vector<std::size_t> openParts;           // Commands starting the cacheable parts not ended yet.
+
+    // Pools. Copies of texts and shapes are reused between frames (only the used prefix is valid),
+    // so a steady frame doesn't reallocate their vertex arrays.
+    std::vector<sf::Vertex> vertices;             // Vertices of all runs.
+    std::vector<Run> runs;                        // Triangle runs.
+    std::vector<sf::Color> clears;                // Clear colours.
+    std::vector<Part> parts;                      // Cacheable parts.
+    std::vector<sf::Text> texts;                  // Copies of recorded texts.
+    std::size_t textCount = 0;                    // Texts used this frame.
+    std::vector<sf::RectangleShape> rectangles;   // Copies of recorded rectangles.
+    std::size_t rectangleCount = 0;               // Rectangles used this frame.
+    std::vector<sf::CircleShape> circles;         // Copies of recorded circles.
+    std::size_t circleCount = 0;                  // Circles used this frame.
+};
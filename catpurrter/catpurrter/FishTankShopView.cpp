@@ -22,46 +22,29 @@ void FishTankShopView::init() {
     { "fish2", "Blue Tang", 100 },
     { "fish3", "Puffer Fish", 100 }
     };
-    itemTexts.clear();
-    float y = 150.f;
-    for (const auto& [id, label, price] : items) {
-        sf::Text text;
-        text.setFont(font);
-        text.setCharacterSize(28);
-        text.setFillColor(sf::Color::White);
-        text.setPosition(100.f, y);
-        itemTexts.push_back(text);
-        y += 40.f;
-    }
-
-    updateOptionColors();
+    optionList.setup(font, 28, { 100.f, 150.f }, 40.f);
+    refreshOptions();
 }
 
-void FishTankShopView::render(sf::RenderWindow& window) {
-    sf::RectangleShape bg(sf::Vector2f(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y)));
+void FishTankShopView::render(DrawList& window) {
+    sf::RectangleShape bg(window.getView().getSize());
     bg.setFillColor(sf::Color(120, 60, 200));
     window.draw(bg);
 
     gameManager->drawSectionTitle(window, font, "Fish Tank Shop");
     gameManager->drawCoinDisplay(window, font, playerData.coins);
 
-    for (const auto& opt : itemTexts)
-        window.draw(opt);
+    optionList.render(window);
 }
 
 
 void FishTankShopView::handleInput(sf::Keyboard::Key key) {
     if (key == sf::Keyboard::Escape) {
-        closeFlag = true;
+        requestClose();
         return;
     }
-    if (key == sf::Keyboard::Up || key == sf::Keyboard::W) {
-        if (selectedIndex > 0) selectedIndex--;
-    }
-    else if (key == sf::Keyboard::Down || key == sf::Keyboard::S) {
-        if (selectedIndex < static_cast<int>(items.size()) - 1) selectedIndex++;
-    }
-    else if (key == sf::Keyboard::Enter) {
+    if (optionList.handleKey(key)) {
+        const int selectedIndex = optionList.getSelected();
         const std::string& selectedId = std::get<0>(items[selectedIndex]);
         int price = std::get<2>(items[selectedIndex]);
 
@@ -73,12 +56,13 @@ void FishTankShopView::handleInput(sf::Keyboard::Key key) {
         else if (playerData.coins >= price) {
             playerData.coins -= price;
             playerData.aquariumContents.push_back(selectedId);
+            playerData.markInventoryChanged();
             std::thread saveThread([&]() {
                 playerData.saveToFile("saves/save.json");
                 });
             saveThread.detach();
             std::cout << "Bought: " << selectedId << "\n";
-            updateOptionColors();
+            refreshOptions();
             if (gameManager->getRoomView())
                 gameManager->getRoomView()->refreshAquariumVisuals();
         }
@@ -86,26 +70,17 @@ void FishTankShopView::handleInput(sf::Keyboard::Key key) {
             std::cout << "Not enough coins\n";
         }
     }
-
-    updateOptionColors();
 }
 
-void FishTankShopView::updateOptionColors() {
+void FishTankShopView::refreshOptions() {
+    std::vector<std::string> labels;
     for (size_t i = 0; i < items.size(); ++i) {
         const auto& [id, label, price] = items[i];
         bool owned = std::ranges::find(playerData.aquariumContents, id) != playerData.aquariumContents.end();
 
         std::string display = label + " - " + std::to_string(price) + " coins";
         if (owned) display += " (Owned)";
-        itemTexts[i].setString(display);
-        itemTexts[i].setFillColor(i == selectedIndex ? sf::Color::Yellow : sf::Color::White);
+        labels.push_back(display);
     }
-}
-
-bool FishTankShopView::shouldClose() const {
-    return closeFlag; 
-}
-
-void FishTankShopView::resetCloseFlag() {
-    closeFlag = false; 
+    optionList.setItems(labels);
 }
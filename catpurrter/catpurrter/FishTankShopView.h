@@ -18,21 +18,13 @@ public:
     void handleInput(sf::Keyboard::Key key) override;
 
     // Draws the shop UI, item list, and highlights to the window.
-    void render(sf::RenderWindow& window) override;
-
-    // Returns true if the player requested to close the shop.
-    bool shouldClose() const override;
-
-    // Resets the close flag so the shop view can be reopened.
-    void resetCloseFlag() override;
+    void render(DrawList& window) override;
 
 private:
     // List of items for sale: tuple of (id, display name, price)
     std::vector<std::tuple<std::string, std::string, int>> items;
 
-    // Display texts for each shop item (to show on screen)
-    std::vector<sf::Text> itemTexts;
 
-    // Updates text color and string to reflect selection and ownership status.
-    void updateOptionColors() override;
+    // Rebuilds the option labels, marking the ones already owned.
+    void refreshOptions() override;
 };
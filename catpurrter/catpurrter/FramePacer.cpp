@@ -0,0 +1,47 @@
+#include "FramePacer.h"
+
+namespace {
+    // sf::sleep is trusted up to this close to the deadline; the rest is spun.
+    const sf::Time SPIN_MARGIN = sf::milliseconds(2);
+}
+
+FramePacer::FramePacer(unsigned targetFps, std::size_t history)
+    : samples(history) {
+    setTargetFps(targetFps);
+    restart();
+}
+
+void FramePacer::setTargetFps(unsigned fps) {
+    targetFps = fps;
+    period = fps > 0 ? sf::seconds(1.f / static_cast<float>(fps)) : sf::Time::Zero;
+    deadline = clock.getElapsedTime() + period;
+}
+
+void FramePacer::wait() {
+    if (targetFps > 0) {
+        sf::Time now = clock.getElapsedTime();
+        if (deadline - now > SPIN_MARGIN)
+            sf::sleep(deadline - now - SPIN_MARGIN);
+        while (clock.getElapsedTime() < deadline) {
+        }
+
+        // Next deadline is one period on, unless this frame ran over by a whole period: then don't try to catch up
+        deadline += period;
+        now = clock.getElapsedTime();
+        if (deadline < now)
+            deadline = now + period;
+    }
+
+    sf::Time now = clock.getElapsedTime();
+    samples.add((now - frameStart).asSeconds() * 1000.f);
+    frameStart = now;
+}
+
+void FramePacer::restart() {
+    frameStart = clock.getElapsedTime();
+    deadline = frameStart + period;
+}
+
+float FramePacer::percentile(float p) const {
+    return samples.percentile(p);
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <SFML/System.hpp>
+#include "SampleHistory.h"
+
+// FramePacer holds the main loop to a target frame rate and records how long each frame took.
+// wait() sleeps most of the remaining frame time and spins the last bit, because sf::sleep can
+// oversleep by a millisecond or more; deadlines advance by whole periods, so the error doesn't add up.
+// The last few seconds of frame times are kept in a ring buffer for percentile queries (F3, benchmarks).
+class FramePacer {
+public:
+    // Creates a pacer for the given target (0 = uncapped) keeping `history` frame times.
+    explicit FramePacer(unsigned targetFps = 60, std::size_t history = 600);
+
+    // Sets the target frame rate (0 = uncapped, e.g. when vsync does the pacing).
+    void setTargetFps(unsigned fps);
+
+    // Returns the target frame rate (0 = uncapped).
+    unsigned getTargetFps() const { return targetFps; }
+
+    // Call once per frame, right after display(): waits for the frame's deadline and records its length.
+    void wait();
+
+    // Forgets the current frame without recording it (after the loop blocked on purpose, e.g. in waitEvent).
+    void restart();
+
+    // Returns the given percentile (0-100) of the recorded frame times, in milliseconds (0 if none yet).
+    float percentile(float p) const;
+
+    // Returns how many frame times are recorded (at most the history size).
+    std::size_t getSampleCount() const { return samples.size(); }
+
+private:
+    unsigned targetFps = 60;     // Frames per second to hold (0 = uncapped).
+    sf::Time period;             // Length of one frame at targetFps.
+    sf::Clock clock;             // Runs since construction; deadlines are measured on it.
+    sf::Time deadline;           // When the current frame should end.
+    sf::Time frameStart;         // When the current frame began.
+
+    SampleHistory samples;       // Recent frame times in milliseconds.
+};
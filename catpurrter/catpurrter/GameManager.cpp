@@ -5,36 +5,135 @@
 #include "Shelf.h"
 #include "StorageRack.h"
 #include "Computer.h"
-#include "SnakeGame.h"
-#include "CatchGame.h"
-#include "DodgeGame.h"
+#include "MiniGameRegistry.h"
+#include "AssetCache.h"
 
+#include <algorithm>
 #include <iostream>
 
+namespace {
+    // Render-thread time per frame spent turning decoded images into textures.
+    const sf::Time UPLOAD_BUDGET = sf::milliseconds(4);
+
+    // Frame rate while the window is in the background.
+    const unsigned BACKGROUND_FPS = 10;
+
+    // Length of one simulation step (120 Hz), whatever the frame rate.
+    const float SIM_STEP = 1.f / 120.f;
+
+    // Longest frame the simulation catches up on; after a longer hitch the game slows down instead of jumping.
+    const float MAX_FRAME_TIME = 0.25f;
+
+    // How long a static screen sleeps between checks while assets are still streaming in.
+    const sf::Time LOADING_POLL = sf::milliseconds(15);
+
+    // Character sizes the game's texts use (with the outline of the loading label); their glyphs are laid out at startup.
+    const unsigned TEXT_SIZES[] = { 22, 24, 26, 28, 30, 32, 36, 38, 40, 48 };
+    const unsigned OUTLINED_SIZE = 24;
+    const float OUTLINE_THICKNESS = 2.f;
+
+    // Renders every printable ASCII glyph the game's texts can ask for. The render thread reads the font's
+    // glyph pages while the main thread lays texts out, so the font must not grow once frames are drawn.
+    void prewarmGlyphs(const sf::Font& font) {
+        for (sf::Uint32 c = 32; c < 127; ++c) {
+            for (unsigned size : TEXT_SIZES)
+                font.getGlyph(c, size, false);
+            font.getGlyph(c, OUTLINED_SIZE, false, OUTLINE_THICKNESS);
+        }
+    }
+}
+
+namespace {
+    // Builds a scene and runs its init().
+    template<typename T, typename... Args>
+    std::unique_ptr<Scene> makeScene(Args&&... args) {
+        auto scene = std::make_unique<T>(std::forward<Args>(args)...);
+        scene->init();
+        return scene;
+    }
+}
+
+const char* gameStateName(GameState state) {
+    switch (state) {
+    case GameState::StartMenu:        return "StartMenu";
+    case GameState::RoomView:         return "RoomView";
+    case GameState::ComputerView:     return "ComputerView";
+    case GameState::StorageView:      return "StorageView";
+    case GameState::ShelfView:        return "ShelfView";
+    case GameState::ShopCategoryView: return "ShopCategoryView";
+    case GameState::HatShop:          return "HatShop";
+    case GameState::ShelfShop:        return "ShelfShop";
+    case GameState::FishTankShop:     return "FishTankShop";
+    case GameState::MiniGameShop:     return "MiniGameShop";
+    case GameState::AquariumView:     return "AquariumView";
+    case GameState::MiniGame:         return "MiniGame";
+    }
+    return "Unknown";
+}
+
+bool isAnimatedState(GameState state) {
+    switch (state) {
+    case GameState::RoomView:     // Walking is polled from held keys every frame
+    case GameState::AquariumView: // Fish swim on their own
+    case GameState::MiniGame:     // Games tick with dt
+        return true;
+    default:
+        return false;
+    }
+}
+
 GameManager::GameManager()
-    : window(sf::VideoMode(800, 600), "Catpurrter - Start Menu"), selectedIndex(0), state(GameState::StartMenu)
+    : window(sf::VideoMode(800, 600), "Catpurrter - Start Menu"), renderer(window), selectedIndex(0), state(GameState::StartMenu)
 {
     window.setKeyRepeatEnabled(false);
+    settings.loadFromFile("settings.json");
+    window.setVerticalSyncEnabled(settings.vsync);
+    renderer.configure(sf::seconds(settings.renderBudgetMs / 1000.f), settings.minRenderScale, settings.dynamicResolution);
+    updatePacing();
+    AssetCache::instance().setBudget(static_cast<std::size_t>(settings.textureBudgetMB) * 1024 * 1024);
+    AssetCache::instance().setScope(gameStateName(state));
     loadFont();
     initMenu();
+
+    // Frames recorded from here on may still be drawing while assets are evicted
+    AssetCache::instance().setReleaseFence([this] { renderer.waitIdle(); });
+    renderer.start();
+    inputThread.start();
 }
 
 void GameManager::loadFont() {
-    if (!font.loadFromFile("assets/fonts/Roboto-VariableFont_wdth,wght.ttf")) {
+    font = AssetCache::instance().getFont("assets/fonts/Roboto-VariableFont_wdth,wght.ttf");
+    if (!font) {
         std::cerr << "Error loading font\n";
+        font = std::make_shared<sf::Font>();
     }
+    prewarmGlyphs(*font);
+}
+
+void GameManager::startRoom() {
+    // A new or loaded save makes every scene built for the old one stale
+    activeMiniGame.reset();
+    scenes.clear();
+    openScene(GameState::RoomView, [this] { return makeScene<Room>(*font, playerData); });
+}
+
+void GameManager::closeWindow() {
+    // The render thread owns the window's context, so it has to go first
+    inputThread.stop();
+    renderer.stop();
+    AssetCache::instance().setReleaseFence(nullptr);
+    window.close();
 }
 
 void GameManager::initMenu() {
-    if (!startMenuBgTexture.loadFromFile("assets/graphics/start.png")) {
-        std::cout << "Failed to load start menu background!\n";
-    }
-    startMenuBgSprite.setTexture(startMenuBgTexture);
+    startMenuBgTexture = AssetCache::instance().getTexture("assets/graphics/start.png");
+    if (startMenuBgTexture)
+        startMenuBgSprite.setTexture(*startMenuBgTexture);
 
     std::vector<std::string> options = { "New Game", "Load Game", "Exit" };
     for (size_t i = 0; i < options.size(); ++i) {
         sf::Text text;
-        text.setFont(font);
+        text.setFont(*font);
         text.setString(options[i]);
         text.setCharacterSize(40);
         text.setPosition(300.f, 200.f + i * 60.f);
@@ -45,65 +144,151 @@ void GameManager::initMenu() {
 
 void GameManager::run() {
     while (window.isOpen()) {
-        float dt = frameClock.restart().asSeconds();
+        AssetCache& cache = AssetCache::instance();
+        cache.pumpUploads(UPLOAD_BUDGET);
+        if (pendingOpen && cache.isReady(pendingAssets)) {
+            auto open = std::move(pendingOpen);
+            pendingOpen = nullptr;
+            open();
+            needsRedraw = true;
+        }
+        cache.setScope(gameStateName(state));
+        cache.enforceBudget();
+        // Suspended scenes keep their textures alive; drop the oldest while that leaves the cache over budget
+        while (cache.isOverBudget() && scenes.evictOldest())
+            cache.enforceBudget();
+        updateSampling();
+        waitForEvents();
         processEvents();
-        handleContinuousMovement();
-        update(dt);
-        render();
+        updateSampling();
+
+        // Time spent asleep on a static screen isn't game time
+        float dt = frameClock.restart().asSeconds();
+        const sf::Int64 frameTime = InputThread::now();
+        if (isAnimatedState(state)) {
+            // Animated screens advance in fixed steps, so speed and outcomes don't depend on the frame rate.
+            // The steps cover the time up to accumulator before now; each takes the key changes made before it ends.
+            accumulator += std::min(dt, MAX_FRAME_TIME);
+            sf::Int64 stepEnd = frameTime - static_cast<sf::Int64>((accumulator - SIM_STEP) * 1000000.f);
+            while (accumulator >= SIM_STEP) {
+                consumeInput(stepEnd);
+                update(SIM_STEP);
+                accumulator -= SIM_STEP;
+                stepEnd += static_cast<sf::Int64>(SIM_STEP * 1000000.f);
+            }
+        }
+        else {
+            // Static screens only react to input
+            consumeInput(frameTime);
+            update(0.f);
+            accumulator = 0.f;
+        }
+        updatePreloadTarget();
+
+        if (state != renderedState)
+            needsRedraw = true;
+        if (needsRedraw || isAnimatedState(state)) {
+            render(accumulator / SIM_STEP);
+            renderedState = state;
+            needsRedraw = false;
+            pacer.wait();
+        }
     }
 }
 
-void GameManager::processEvents() {
+void GameManager::updatePacing() {
+    // Unfocused (or minimized) windows still tick, just slowly
+    if (!focused)
+        pacer.setTargetFps(BACKGROUND_FPS);
+    else
+        pacer.setTargetFps(settings.vsync ? 0 : static_cast<unsigned>(settings.frameRateCap));
+}
+
+void GameManager::updateSampling() {
+    // Only the animated screens step on sampled keys; anywhere else the thread would poll for nothing
+    inputThread.setEnabled(focused && isAnimatedState(state));
+}
+
+void GameManager::waitForEvents() {
+    if (isAnimatedState(state) || needsRedraw)
+        return;
+
+    // Uploads and view switches only progress inside the loop, so keep it turning (slowly) until they're done
+    if (pendingOpen || AssetCache::instance().isLoading()) {
+        sf::sleep(LOADING_POLL);
+        pacer.restart();
+        return;
+    }
+
     sf::Event event;
-    while (window.pollEvent(event)) {
-        if (event.type == sf::Event::Closed)
-            window.close();
-
-        if (event.type == sf::Event::KeyPressed)
-            keyState[event.key.code] = true;
-        if (event.type == sf::Event::KeyReleased)
-            keyState[event.key.code] = false;
-
-        if (event.type == sf::Event::KeyPressed) {
-            switch (state) {
-            case GameState::StartMenu:
-                processStartMenuEvents(event);
-                break;
-            case GameState::RoomView:
-                processRoomViewEvents(event);
-                break;
-            case GameState::ComputerView:
-                processComputerViewEvents(event);
-                break;
-            case GameState::StorageView:
-                processStorageViewEvents(event);
-                break;
-            case GameState::HatShop:
-                processHatShopEvents(event);
-                break;
-            case GameState::MiniGame:
-                processMiniGameEvents(event);
-                break;
-            case GameState::ShelfView:
-                processShelfViewEvents(event);
-                break;
-            case GameState::ShopCategoryView:
-                processShopCategoryViewEvents(event);
-                break;
-            case GameState::ShelfShop:
-                processShelfShopEvents(event);
-                break;
-            case GameState::AquariumView:
-                processAquariumViewEvents(event);
-                break;
-            case GameState::FishTankShop:
-                processFishTankShopEvents(event);
-                break;
-            case GameState::MiniGameShop:
-                processMiniGameShopEvents(event);
-                break;
-            }
+    if (window.waitEvent(event)) {
+        handleEvent(event);
+        frameClock.restart();
+        pacer.restart();
+    }
+}
+
+void GameManager::consumeInput(sf::Int64 until) {
+    input.beginStep();
+    InputEvent event;
+    while (inputThread.pop(until, event)) {
+        if (event.pressed) {
+            input.press(event.key);
+            // Latency is only measured where frames follow the steps; static screens draw on window events
+            if (unpresentedInput < 0 && isAnimatedState(state))
+                unpresentedInput = event.time;
         }
+        else {
+            input.release(event.key);
+        }
+    }
+}
+
+void GameManager::processEvents() {
+    sf::Event event;
+    while (window.pollEvent(event))
+        handleEvent(event);
+}
+
+void GameManager::handleEvent(const sf::Event& event) {
+    if (event.type == sf::Event::Closed)
+        closeWindow();
+
+    // Anything but the mouse wandering over the window may change what's on screen
+    if (event.type != sf::Event::MouseMoved)
+        needsRedraw = true;
+
+    if (event.type == sf::Event::LostFocus) {
+        focused = false;
+        inputThread.setEnabled(false);
+        updatePacing();
+    }
+    if (event.type == sf::Event::GainedFocus) {
+        focused = true;
+        updateSampling();
+        updatePacing();
+    }
+
+
+    // F3 dumps asset cache counters and per-screen residency (debug helper, works on every screen)
+    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+        AssetCache::instance().printStats(std::cout);
+        AssetCache::instance().printResidency(std::cout);
+        if (Room* room = getRoomView())
+            std::cout << "Room: " << room->getDrawCalls() << " draw calls, " << room->getQuadCount() << " quads last frame\n";
+        std::cout << "Scenes: " << scenes.getSuspendedCount() << " suspended\n";
+        std::cout << "World resolution scale: " << static_cast<int>(renderer.getScale() * 100.f + 0.5f) << "%\n";
+        std::cout << "Frame time (ms, last " << pacer.getSampleCount() << " frames): p50 " << pacer.percentile(50.f)
+            << ", p95 " << pacer.percentile(95.f) << ", p99 " << pacer.percentile(99.f) << "\n";
+        std::cout << "Input to present (ms, last " << renderer.getInputLatencyCount() << " presses): p50 "
+            << renderer.inputLatencyPercentile(50.f) << ", p95 " << renderer.inputLatencyPercentile(95.f)
+            << ", p99 " << renderer.inputLatencyPercentile(99.f) << "\n";
+    }
+
+    // Keys are ignored while a view switch is loading, so they can't act on the screen being left
+    if (event.type == sf::Event::KeyPressed && !pendingOpen) {
+        if (auto onKey = currentHandlers().onKey)
+            onKey(*this, event);
     }
 }
 
@@ -121,10 +306,7 @@ void GameManager::processStartMenuEvents(const sf::Event& event) {
                 playerData.equippedHat = "none";
                 playerData.unlockedHats = {};
                 playerData.saveToFile("saves/save.json");
-                if (roomView) delete roomView;
-                roomView = new Room(font, playerData);
-                roomView->init();
-                state = GameState::RoomView;
+                openWhenLoaded(Room::requiredAssets(playerData), [this] { startRoom(); });
             }
             showingNewGameConfirm = false;
         }
@@ -142,321 +324,254 @@ void GameManager::processStartMenuEvents(const sf::Event& event) {
 }
 
 void GameManager::processRoomViewEvents(const sf::Event& event) {
-    if (roomView) {
-        roomView->handleInput(event.key.code);
-        roomView->update();
-        if ((event.key.code == sf::Keyboard::Enter || event.key.code == sf::Keyboard::Space) && roomView->isNearObject()) {
-            std::string obj = roomView->getNearbyObject();
-            if (obj == "Computer") {
-                state = GameState::ComputerView;
-                if (computerView) delete computerView;
-                computerView = new Computer(font, playerData);
-                computerView->init();
-            }
-            else if (obj == "Aquarium") {
-                state = GameState::AquariumView;
-                if (aquariumView) delete aquariumView;
-                aquariumView = new Aquarium(font, playerData);
-                aquariumView->init();
-            }
-            else if (obj == "Shelves") {
-                state = GameState::ShelfView;
-                if (shelfView) delete shelfView;
-                shelfView = new Shelf(font, playerData);
-                shelfView->init();
-            }
-            else if (obj == "Storage Rack") {
-                state = GameState::StorageView;
-                if (storageRackView) delete storageRackView;
-                storageRackView = new StorageRack(font, playerData, this);
-                storageRackView->init();
-            }
-            else if (obj == "Doors") {
-                state = GameState::StartMenu;
-                selectedIndex = 0;
-                menuItems.clear();
-                initMenu();
-            }
-        }
+    Room* room = scenes.topAs<Room>();
+    if (room && InputState::isBound(Action::Confirm, event.key.code) && room->isNearObject())
+        openRoomObject(room->getNearbyObject());
+}
+
+void GameManager::openRoomObject(int object) {
+    switch (object) {
+    case RoomSim::COMPUTER:
+        openWhenLoaded(Computer::requiredAssets(playerData), [this] {
+            openScene(GameState::ComputerView, [this] { return makeScene<Computer>(*font, playerData); });
+        });
+        break;
+    case RoomSim::AQUARIUM:
+        openWhenLoaded(Aquarium::requiredAssets(playerData), [this] {
+            openScene(GameState::AquariumView, [this] { return makeScene<Aquarium>(*font, playerData); });
+        });
+        break;
+    case RoomSim::SHELVES:
+        openWhenLoaded(Shelf::requiredAssets(playerData), [this] {
+            openScene(GameState::ShelfView, [this] { return makeScene<Shelf>(*font, playerData); });
+        });
+        break;
+    case RoomSim::STORAGE_RACK:
+        openWhenLoaded(StorageRack::requiredAssets(playerData), [this] {
+            openScene(GameState::StorageView, [this] { return makeScene<StorageRack>(*font, playerData, this); });
+        });
+        break;
+    case RoomSim::DOORS:
+        closeScene();
+        selectedIndex = 0;
+        menuItems.clear();
+        initMenu();
+        break;
+    default:
+        break;
     }
 }
 
 void GameManager::processComputerViewEvents(const sf::Event& event) {
-    computerView->handleInput(event.key.code);
-    if (computerView->shouldClose()) {
-        delete computerView;
-        computerView = nullptr;
-        state = GameState::RoomView;
+    Computer* computer = scenes.topAs<Computer>();
+    if (!computer)
+        return;
+    computer->handleInput(event.key.code);
+    if (closeRequestedScene())
         return;
-    }
     if (event.key.code == sf::Keyboard::Enter) {
-        ComputerSelection choice = computerView->getSelectedOption();
+        ComputerSelection choice = computer->getSelectedOption();
         if (choice == ComputerSelection::Shop) {
-            state = GameState::ShopCategoryView;
-            if (shopCategoryView) delete shopCategoryView;
-            shopCategoryView = new ShopCategoryView(font);
-            shopCategoryView->init();
+            openScene(GameState::ShopCategoryView, [this] { return makeScene<ShopCategoryView>(*font); });
         }
         else if (choice == ComputerSelection::Back) {
-            delete computerView;
-            computerView = nullptr;
-            state = GameState::RoomView;
+            closeScene();
+            return;
         }
-        const std::string& selectedGame = computerView->getSelectedMiniGame();
+        const std::string selectedGame = computer->getSelectedMiniGame();
         if (!selectedGame.empty()) {
-            if (selectedGame == "snake") {
-                if (snakeGame) delete snakeGame;
-                snakeGame = new SnakeGame(font, playerData, *this);
-                snakeGame->init();
-                state = GameState::MiniGame;
-            }
-            else if (selectedGame == "catch") {
-                if (catchGame) delete catchGame;
-                catchGame = new CatchGame(font, playerData, *this);
-                catchGame->init();
-                state = GameState::MiniGame;
-            }
-            else if (selectedGame == "dodge") {
-                if (dodgeGame) delete dodgeGame;
-                dodgeGame = new DodgeGame(font, playerData, *this);
-                dodgeGame->init();
-                state = GameState::MiniGame;
-            }
-            computerView->clearSelectedMiniGame();
-            return;
+            computer->clearSelectedMiniGame();
+            startMiniGame(selectedGame);
         }
     }
 }
 
-void GameManager::processStorageViewEvents(const sf::Event& event) {
-    if (storageRackView)
-        storageRackView->handleInput(event.key.code);
-    if (storageRackView && storageRackView->shouldClose()) {
-        storageRackView->resetCloseFlag();
-        delete storageRackView;
-        storageRackView = nullptr;
-        state = GameState::RoomView;
-    }
-}
-
-void GameManager::processHatShopEvents(const sf::Event& event) {
-    if (hatShopView)
-        hatShopView->handleInput(event.key.code);
-    if (hatShopView && hatShopView->shouldClose()) {
-        hatShopView->resetCloseFlag();
-        delete hatShopView;
-        hatShopView = nullptr;
-        state = GameState::ShopCategoryView;
-    }
+template<typename T>
+void GameManager::forwardKey(GameManager& gm, const sf::Event& event) {
+    if (T* scene = gm.scenes.topAs<T>())
+        scene->handleInput(event.key.code);
+    gm.closeRequestedScene();
 }
 
 void GameManager::processMiniGameEvents(const sf::Event& event) {
-    if (snakeGame)
-        snakeGame->handleInput(event.key.code);
-    else if (catchGame)
-        catchGame->handleInput(event.key.code);
-    else if (dodgeGame)
-        dodgeGame->handleInput(event.key.code);
-}
-
-void GameManager::processShelfViewEvents(const sf::Event& event) {
-    if (shelfView)
-        shelfView->handleInput(event.key.code);
-    if (shelfView && shelfView->shouldClose()) {
-        shelfView->resetCloseFlag();
-        state = GameState::RoomView;
-    }
+    if (!activeMiniGame)
+        return;
+    activeMiniGame->handleInput(event.key.code);
+    if (activeMiniGame->isCloseRequested())
+        closeMiniGame();
 }
 
 void GameManager::processShopCategoryViewEvents(const sf::Event& event) {
-    if (shopCategoryView)
-        shopCategoryView->handleInput(event.key.code);
-    if (shopCategoryView && shopCategoryView->shouldClose()) {
-        shopCategoryView->resetCloseFlag();
-        state = GameState::ComputerView;
-    }
-    else if (shopCategoryView) {
-        ShopSelection selected = shopCategoryView->getSelectedOption();
-        if (selected != ShopSelection::None) {
-            switch (selected) {
-            case ShopSelection::HatShop:
-                if (hatShopView) delete hatShopView;
-                hatShopView = new HatShopView(font, playerData, this);
-                hatShopView->init();
-                state = GameState::HatShop;
-                break;
-            case ShopSelection::FishTankShop:
-                if (fishTankShopView) delete fishTankShopView;
-                fishTankShopView = new FishTankShopView(font, playerData, this);
-                fishTankShopView->init();
-                state = GameState::FishTankShop;
-                break;
-            case ShopSelection::ShelfShop:
-                if (shelfShopView) delete shelfShopView;
-                shelfShopView = new ShelfShopView(font, playerData, this);
-                shelfShopView->init();
-                state = GameState::ShelfShop;
-                break;
-            case ShopSelection::MiniGameShop:
-                if (miniGameShopView) delete miniGameShopView;
-                miniGameShopView = new MiniGameShopView(font, playerData, this);
-                miniGameShopView->init();
-                state = GameState::MiniGameShop;
-                break;
-            default:
-                break;
-            }
-            shopCategoryView->clearSelection();
-        }
-    }
-}
+    ShopCategoryView* categories = scenes.topAs<ShopCategoryView>();
+    if (!categories)
+        return;
+    categories->handleInput(event.key.code);
+    if (closeRequestedScene())
+        return;
 
-void GameManager::processShelfShopEvents(const sf::Event& event) {
-    if (shelfShopView)
-        shelfShopView->handleInput(event.key.code);
-    if (shelfShopView && shelfShopView->shouldClose()) {
-        shelfShopView->resetCloseFlag();
-        state = GameState::ShopCategoryView;
+    ShopSelection selected = categories->getSelectedOption();
+    if (selected == ShopSelection::None)
+        return;
+    categories->clearSelection();
+    switch (selected) {
+    case ShopSelection::HatShop:
+        openScene(GameState::HatShop, [this] { return makeScene<HatShopView>(*font, playerData, this); });
+        break;
+    case ShopSelection::FishTankShop:
+        openScene(GameState::FishTankShop, [this] { return makeScene<FishTankShopView>(*font, playerData, this); });
+        break;
+    case ShopSelection::ShelfShop:
+        openScene(GameState::ShelfShop, [this] { return makeScene<ShelfShopView>(*font, playerData, this); });
+        break;
+    case ShopSelection::MiniGameShop:
+        openScene(GameState::MiniGameShop, [this] { return makeScene<MiniGameShopView>(*font, playerData, this); });
+        break;
+    default:
+        break;
     }
 }
 
-void GameManager::processAquariumViewEvents(const sf::Event& event) {
-    if (aquariumView)
-        aquariumView->handleInput(event.key.code);
-    if (aquariumView && aquariumView->shouldClose()) {
-        aquariumView->resetCloseFlag();
-        state = GameState::RoomView;
-    }
+void GameManager::openScene(GameState target, const std::function<std::unique_ptr<Scene>()>& create) {
+    openScene(target, gameStateName(target), create);
 }
 
-void GameManager::processFishTankShopEvents(const sf::Event& event) {
-    if (fishTankShopView)
-        fishTankShopView->handleInput(event.key.code);
-    if (fishTankShopView && fishTankShopView->shouldClose()) {
-        fishTankShopView->resetCloseFlag();
-        delete fishTankShopView;
-        fishTankShopView = nullptr;
-        state = GameState::ShopCategoryView;
-    }
+void GameManager::openScene(GameState target, const std::string& key, const std::function<std::unique_ptr<Scene>()>& create) {
+    if (!scenes.resume(key))
+        scenes.push(target, key, create());
+    state = scenes.topState(GameState::StartMenu);
 }
 
-void GameManager::processMiniGameShopEvents(const sf::Event& event) {
-    if (miniGameShopView)
-        miniGameShopView->handleInput(event.key.code);
-    if (miniGameShopView && miniGameShopView->shouldClose()) {
-        miniGameShopView->resetCloseFlag();
-        delete miniGameShopView;
-        miniGameShopView = nullptr;
-        if (computerView) delete computerView;
-        computerView = new Computer(font, playerData);
-        computerView->init();
-        if (shopCategoryView) delete shopCategoryView;
-        shopCategoryView = new ShopCategoryView(font);
-        shopCategoryView->init();
-        shopCategoryView->setSelectionIndex(3);
-        state = GameState::ShopCategoryView;
-    }
+void GameManager::closeScene() {
+    scenes.pop();
+    state = scenes.topState(GameState::StartMenu);
 }
 
+bool GameManager::closeRequestedScene() {
+    if (!scenes.popClosed())
+        return false;
+    state = scenes.topState(GameState::StartMenu);
+    return true;
+}
 
+void GameManager::startMiniGame(const std::string& id) {
+    activeMiniGame = MiniGameRegistry::instance().create(id, *font, playerData, *this);
+    if (!activeMiniGame) {
+        std::cout << "Unknown mini game: " << id << "\n";
+        return;
+    }
+    state = GameState::MiniGame;
+}
+
+void GameManager::closeMiniGame() {
+    activeMiniGame.reset();
+    state = scenes.topState(GameState::StartMenu);
+}
+
+const std::array<GameManager::StateHandlers, GAME_STATE_COUNT> GameManager::stateHandlers = GameManager::buildStateHandlers();
+
+std::array<GameManager::StateHandlers, GAME_STATE_COUNT> GameManager::buildStateHandlers() {
+    std::array<StateHandlers, GAME_STATE_COUNT> table{};
+    auto entry = [&table](GameState state) -> StateHandlers& { return table[static_cast<std::size_t>(state)]; };
+
+    entry(GameState::StartMenu) = {
+        [](GameManager& gm, const sf::Event& event) { gm.processStartMenuEvents(event); },
+        [](GameManager& gm, float) { gm.updateStartMenu(); },
+        [](GameManager& gm, DrawList& target, float) { target.draw(gm.startMenuBgSprite); },
+        [](GameManager& gm, DrawList& target, float) { gm.renderStartMenu(target); }
+    };
+    entry(GameState::RoomView) = {
+        [](GameManager& gm, const sf::Event& event) { gm.processRoomViewEvents(event); },
+        [](GameManager& gm, float dt) {
+            if (Room* room = gm.scenes.topAs<Room>())
+                room->update(dt, gm.input);
+        },
+        [](GameManager& gm, DrawList& target, float alpha) {
+            if (Room* room = gm.scenes.topAs<Room>()) room->render(target, alpha);
+        },
+        [](GameManager& gm, DrawList& target, float) {
+            if (Room* room = gm.scenes.topAs<Room>()) room->renderUi(target);
+            gm.drawCoinDisplay(target, *gm.font, gm.playerData.coins, sf::Vector2f(30.f, 20.f));
+        }
+    };
+    entry(GameState::ComputerView) = {
+        [](GameManager& gm, const sf::Event& event) { gm.processComputerViewEvents(event); },
+        [](GameManager& gm, float) { if (Computer* computer = gm.scenes.topAs<Computer>()) computer->update(); },
+        [](GameManager& gm, DrawList& target, float) { if (Computer* computer = gm.scenes.topAs<Computer>()) computer->render(target); },
+        [](GameManager& gm, DrawList& target, float) { if (Computer* computer = gm.scenes.topAs<Computer>()) computer->renderUi(target); }
+    };
+    entry(GameState::AquariumView) = {
+        &forwardKey<Aquarium>,
+        [](GameManager& gm, float dt) { if (Aquarium* aquarium = gm.scenes.topAs<Aquarium>()) aquarium->update(dt); },
+        [](GameManager& gm, DrawList& target, float alpha) { if (Aquarium* aquarium = gm.scenes.topAs<Aquarium>()) aquarium->render(target, alpha); },
+        [](GameManager& gm, DrawList& target, float) { if (Aquarium* aquarium = gm.scenes.topAs<Aquarium>()) aquarium->renderUi(target); }
+    };
+    entry(GameState::ShelfView) = {
+        &forwardKey<Shelf>,
+        [](GameManager& gm, float) { if (Shelf* shelf = gm.scenes.topAs<Shelf>()) shelf->update(); },
+        [](GameManager& gm, DrawList& target, float) { if (Shelf* shelf = gm.scenes.topAs<Shelf>()) shelf->render(target); },
+        [](GameManager& gm, DrawList& target, float) { if (Shelf* shelf = gm.scenes.topAs<Shelf>()) shelf->renderUi(target); }
+    };
+    entry(GameState::StorageView) = {
+        &forwardKey<StorageRack>,
+        [](GameManager& gm, float) { if (StorageRack* storageRack = gm.scenes.topAs<StorageRack>()) storageRack->update(); },
+        [](GameManager& gm, DrawList& target, float) { if (StorageRack* storageRack = gm.scenes.topAs<StorageRack>()) storageRack->render(target); },
+        [](GameManager& gm, DrawList& target, float) { if (StorageRack* storageRack = gm.scenes.topAs<StorageRack>()) storageRack->renderUi(target); }
+    };
+    entry(GameState::ShopCategoryView) = {
+        [](GameManager& gm, const sf::Event& event) { gm.processShopCategoryViewEvents(event); },
+        nullptr,
+        nullptr,
+        [](GameManager& gm, DrawList& target, float) { if (ShopCategoryView* categories = gm.scenes.topAs<ShopCategoryView>()) categories->render(target); }
+    };
+
+    // The shops are text and flat shapes on the UI layer only, and all behave the same to GameManager
+    const StateHandlers shop = {
+        &forwardKey<ShopViewBase>,
+        nullptr,
+        nullptr,
+        [](GameManager& gm, DrawList& target, float) { if (ShopViewBase* view = gm.scenes.topAs<ShopViewBase>()) view->render(target); }
+    };
+    entry(GameState::HatShop) = shop;
+    entry(GameState::ShelfShop) = shop;
+    entry(GameState::FishTankShop) = shop;
+    entry(GameState::MiniGameShop) = shop; // Games bought here show up on the computer when it's uncovered (Computer::onEnter)
+
+    entry(GameState::MiniGame) = {
+        [](GameManager& gm, const sf::Event& event) { gm.processMiniGameEvents(event); },
+        [](GameManager& gm, float dt) { if (gm.activeMiniGame) gm.activeMiniGame->update(dt, gm.input); },
+        nullptr,
+        [](GameManager& gm, DrawList& target, float alpha) { if (gm.activeMiniGame) gm.activeMiniGame->render(target, alpha); }
+    };
+    return table;
+}
 
 void GameManager::update(float dt) {
-    switch (state) {
-    case GameState::StartMenu:
-        updateStartMenu();
-        break;
-    case GameState::RoomView:
-        if (roomView) roomView->update();
-        break;
-    case GameState::ComputerView:
-        if (computerView) computerView->update();
-        break;
-    case GameState::AquariumView:
-        if (aquariumView) aquariumView->update(dt);
-        break;
-    case GameState::ShelfView:
-        if (shelfView) shelfView->update();
-        break;
-    case GameState::StorageView:
-        if (storageRackView) storageRackView->update();
-        break;
-    case GameState::ShopCategoryView:
-        if (shopCategoryView) shopCategoryView->update();
-        break;
-    case GameState::MiniGame:
-        if (snakeGame)
-            snakeGame->update(dt);
-        if (catchGame)
-            catchGame->update(dt);
-        if (dodgeGame)
-            dodgeGame->update(dt);
-        if (snakeGame && snakeGame->shouldClose()) {
-            delete snakeGame;
-            snakeGame = nullptr;
-            state = GameState::ComputerView;
-        }
-        if (catchGame && catchGame->shouldClose()) {
-            delete catchGame;
-            catchGame = nullptr;
-            state = GameState::ComputerView;
-        }
-        if (dodgeGame && dodgeGame->shouldClose()) {
-            delete dodgeGame;
-            dodgeGame = nullptr;
-            state = GameState::ComputerView;
-        }
-        break;
-    }
+    if (auto step = currentHandlers().update)
+        step(*this, dt);
 }
 
+void GameManager::render(float alpha) {
+    // The frame is only recorded here; the render thread draws it while the next one is simulated
+    DrawList& window = renderer.beginFrame();
 
-void GameManager::render() {
-    window.clear();
-    switch (state) {
-    case GameState::StartMenu:
-        renderStartMenu();
-        break;
-    case GameState::RoomView:
-        if (roomView) roomView->render(window);
-        drawCoinDisplay(window, font, playerData.coins, sf::Vector2f(30.f, 20.f));
-        break;
-    case GameState::ComputerView:
-        if (computerView) computerView->render(window);
-        break;
-    case GameState::AquariumView:
-        if (aquariumView) aquariumView->render(window);
-        break;
-    case GameState::ShelfView:
-        if (shelfView) shelfView->render(window);
-        break;
-    case GameState::StorageView:
-        if (storageRackView) storageRackView->render(window);
-        break;
-    case GameState::ShopCategoryView:
-        if (shopCategoryView) shopCategoryView->render(window);
-        break;
-    case GameState::ShelfShop:
-        if (shelfShopView) shelfShopView->render(window);
-        break;
-    case GameState::FishTankShop:
-        if (fishTankShopView) fishTankShopView->render(window);
-        break;
-    case GameState::MiniGameShop:
-        if (miniGameShopView) miniGameShopView->render(window);
-        break;
-    case GameState::HatShop:
-        if (hatShopView) hatShopView->render(window);
-        break;
-    case GameState::MiniGame:
-        if (snakeGame)
-            snakeGame->render(window);
-        if (catchGame)
-            catchGame->render(window);
-        if (dodgeGame)
-            dodgeGame->render(window);
-        break;
-    }
-    window.display();
+    // World layer: screens with full-screen pictures draw them for the scaled offscreen pass
+    renderWorld(window, alpha);
+
+    // UI layer at native resolution; screens made of text and flat shapes draw everything here
+    window.setLayer(DrawList::Layer::Ui);
+    if (auto renderUi = currentHandlers().renderUi)
+        renderUi(*this, window, alpha);
+    if (pendingOpen)
+        renderLoadingOverlay(window);
+
+    renderer.submit(unpresentedInput);
+    unpresentedInput = -1;
+}
+
+void GameManager::renderWorld(DrawList& target, float alpha) {
+    target.setLayer(DrawList::Layer::World);
+    if (auto renderWorld = currentHandlers().renderWorld)
+        renderWorld(*this, target, alpha);
 }
 
 void GameManager::moveUp() {
@@ -486,23 +601,19 @@ void GameManager::selectOption() {
         std::cout << "Load Game Selected\n";
         if (playerData.loadFromFile("saves/save.json")) {
             std::cout << "Coins: " << playerData.coins << ", Hat: " << playerData.equippedHat << "\n";
-            if (roomView) delete roomView;
-            roomView = new Room(font, playerData);
-            roomView->init();
-            state = GameState::RoomView;
+            openWhenLoaded(Room::requiredAssets(playerData), [this] { startRoom(); });
         }
         else {
             std::cout << "No save file found.\n";
         }
         break;
     case 2:
-        window.close();
+        closeWindow();
         break;
     }
 }
 
-void GameManager::renderStartMenu() {
-    window.draw(startMenuBgSprite);
+void GameManager::renderStartMenu(DrawList& window) {
     for (const auto& item : menuItems)
         window.draw(item);
 
@@ -514,13 +625,13 @@ void GameManager::renderStartMenu() {
         popup.setPosition(130, 180);
         window.draw(popup);
 
-        sf::Text question("Are you sure you want to run new game?\nPrevious save will be deleted", font, 26);
+        sf::Text& question = texts.get("Are you sure you want to run new game?\nPrevious save will be deleted", *font, 26);
         question.setFillColor(sf::Color(120, 60, 255));
         question.setPosition(150, 200);
         window.draw(question);
 
-        sf::Text yesText("Yes", font, 32);
-        sf::Text noText("No", font, 32);
+        sf::Text& yesText = texts.get("Yes", *font, 32);
+        sf::Text& noText = texts.get("No", *font, 32);
 
         sf::Color purple(120, 60, 255);
         sf::Color yellow(200, 170, 40);
@@ -545,59 +656,82 @@ void GameManager::updateStartMenu() {
     }
 }
 
-void GameManager::initMiniGame() {
-    std::cout << "[Mini Game Initialized]\n";
-}
-
-void GameManager::renderMiniGame() {
-    sf::Text text;
-    text.setFont(font);
-    text.setString("Mini Game Coming Soon! Press ESC to return.");
-    text.setCharacterSize(30);
-    text.setFillColor(sf::Color::White);
-    text.setPosition(100.f, 200.f);
-    window.draw(text);
-}
-
-void GameManager::drawSectionTitle(sf::RenderWindow& window, sf::Font& font, const std::string& title) {
-    sf::Text titleText(title, font, 36);
+void GameManager::drawSectionTitle(DrawList& window, sf::Font& font, const std::string& title) {
+    sf::Text& titleText = texts.get(title, font, 36);
     titleText.setFillColor(sf::Color::Cyan);
     titleText.setPosition(100.f, 50.f);
     window.draw(titleText);
 }
 
-void GameManager::drawCoinDisplay(sf::RenderWindow& window, sf::Font& font, int coins, sf::Vector2f pos) {
-    sf::Text currencyText;
-    currencyText.setFont(font);
-    currencyText.setCharacterSize(24);
+void GameManager::drawCoinDisplay(DrawList& window, sf::Font& font, int coins, sf::Vector2f pos) {
+    // Only re-laid out when the coin count changes
+    sf::Text& currencyText = texts.slot("coins", "Coins: " + std::to_string(coins), font, 24);
     currencyText.setFillColor(sf::Color::White);
-    currencyText.setString("Coins: " + std::to_string(coins));
     currencyText.setPosition(pos);
     window.draw(currencyText);
 }
 
-template<typename T>
-void GameManager::handleShopNavigationInput(sf::Keyboard::Key key, int& selectionIndex, const std::vector<T>& items) {
-    if (key == sf::Keyboard::W || key == sf::Keyboard::Up) {
-        if (selectionIndex > 0) selectionIndex--;
-    }
-    else if (key == sf::Keyboard::S || key == sf::Keyboard::Down) {
-        if (selectionIndex < static_cast<int>(items.size()) - 1) selectionIndex++;
+void GameManager::openWhenLoaded(const AssetList& assets, std::function<void()> open) {
+    AssetCache& cache = AssetCache::instance();
+    cache.prefetch(assets);
+    if (cache.isReady(assets)) {
+        open();
+        return;
     }
+    pendingAssets = assets;
+    pendingOpen = std::move(open);
+    needsRedraw = true; // Shows the loading label
 }
 
-void GameManager::handleContinuousMovement() {
-    if (state == GameState::RoomView && roomView) {
-        int dx = 0, dy = 0;
-        if (keyState[sf::Keyboard::A] || keyState[sf::Keyboard::Left])  dx -= 1;
-        if (keyState[sf::Keyboard::D] || keyState[sf::Keyboard::Right]) dx += 1;
-        if (keyState[sf::Keyboard::W] || keyState[sf::Keyboard::Up])    dy -= 1;
-        if (keyState[sf::Keyboard::S] || keyState[sf::Keyboard::Down])  dy += 1;
-        if (dx != 0 || dy != 0)
-            roomView->movePlayer(dx, dy);
+void GameManager::updatePreloadTarget() {
+    // Don't touch the cache while a view switch is waiting on it
+    if (pendingOpen)
+        return;
+
+    switch (state) {
+    case GameState::StartMenu:
+        // "New Game" and "Load Game" both lead to the room
+        if (selectedIndex == 0 || selectedIndex == 1)
+            preloader.setTarget("Room", Room::requiredAssets(playerData));
+        else
+            preloader.clearTarget();
+        break;
+    case GameState::RoomView: {
+        Room* room = scenes.topAs<Room>();
+        switch (room ? room->getNearbyObject() : RoomSim::NO_OBJECT) {
+        case RoomSim::COMPUTER:
+            preloader.setTarget("Computer", Computer::requiredAssets(playerData));
+            break;
+        case RoomSim::AQUARIUM:
+            preloader.setTarget("Aquarium", Aquarium::requiredAssets(playerData));
+            break;
+        case RoomSim::SHELVES:
+            preloader.setTarget("Shelves", Shelf::requiredAssets(playerData));
+            break;
+        case RoomSim::STORAGE_RACK:
+            preloader.setTarget("Storage Rack", StorageRack::requiredAssets(playerData));
+            break;
+        default:
+            preloader.clearTarget();
+            break;
+        }
+        break;
+    }
+    default:
+        preloader.clearTarget();
+        break;
     }
 }
 
+void GameManager::renderLoadingOverlay(DrawList& window) {
+    sf::Text& loadingText = texts.get("Loading...", *font, 24);
+    loadingText.setFillColor(sf::Color::White);
+    loadingText.setOutlineColor(sf::Color::Black);
+    loadingText.setOutlineThickness(2.f);
+    loadingText.setPosition(650.f, 560.f);
+    window.draw(loadingText);
+}
+
 void GameManager::setState(GameState s) {
     state = s;
 }
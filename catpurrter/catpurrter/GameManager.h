@@ -2,7 +2,9 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <string>
-#include <map>
+#include <memory>
+#include <functional>
+#include <array>
 
 // Game entities & views
 #include "Player.h"
@@ -12,6 +14,16 @@
 #include "StorageRack.h"
 #include "Computer.h"
 #include "ShopCategory.h"
+#include "Preloader.h"
+#include "Settings.h"
+#include "TextCache.h"
+#include "FramePacer.h"
+#include "Renderer.h"
+#include "GameState.h"
+#include "SceneStack.h"
+#include "MiniGameBase.h"
+#include "InputState.h"
+#include "InputThread.h"
 
 // Shop views
 #include "HatShopView.h"
@@ -19,26 +31,12 @@
 #include "FishTankShopView.h"
 #include "MiniGameShopView.h"
 
-// Forward declarations for minigames
-class SnakeGame;
-class CatchGame;
-class DodgeGame;
-
-// GameState represents all possible game screens/modes.
-enum class GameState {
-    StartMenu,         // Main menu (new/load/exit)
-    RoomView,          // Player's main room view
-    ComputerView,      // Computer desktop (apps, minigames, shops)
-    StorageView,       // Storage rack (hat equip view)
-    ShelfView,         // Big shelf (shows bought decorations)
-    ShopCategoryView,  // Menu for choosing which shop
-    HatShop,           // Hat shop UI
-    ShelfShop,         // Shelf decorations shop UI
-    FishTankShop,      // Aquarium decorations/fish shop UI
-    MiniGameShop,      // Mini-games shop UI
-    AquariumView,      // Fullscreen aquarium view
-    MiniGame           // Any active mini-game
-};
+// Returns the state's name, e.g. "AquariumView" (used to label assets in the residency report).
+const char* gameStateName(GameState state);
+
+// Returns true for states that change without input (the room, the aquarium, minigames) and so redraw every frame.
+// The others only redraw after an event; in between, run() sleeps in waitEvent.
+bool isAnimatedState(GameState state);
 
 // GameManager is the central controller for the entire game application.
 // Owns the SFML window, manages game state/screens, player data, all views and minigames.
@@ -48,10 +46,10 @@ public:
     // Creates the game manager, initializes window, loads font, and shows start menu.
     GameManager();
 
-    // Main loop: processes events, updates state, renders everything.
+    // Main loop: processes events, updates state, renders. Static screens wait for input instead of redrawing.
     void run();
 
-    // Updates the currently active screen/view/game logic.
+    // Updates the currently active screen/view/game logic by one step of dt seconds (0 on static screens).
     void update(float dt);
 
     // --- State accessors ---
@@ -62,18 +60,34 @@ public:
 
     // --- Drawing utilities ---
     // Draws a large section title at the top of the current view/screen.
-    void drawSectionTitle(sf::RenderWindow& window, sf::Font& font, const std::string& title);
+    void drawSectionTitle(DrawList& window, sf::Font& font, const std::string& title);
     // Draws the player's coin count in the top-right (or custom) position.
-    void drawCoinDisplay(sf::RenderWindow& window, sf::Font& font, int coins, sf::Vector2f pos = { 500.f, 50.f });
+    void drawCoinDisplay(DrawList& window, sf::Font& font, int coins, sf::Vector2f pos = { 500.f, 50.f });
 
-    // Returns a pointer to the current Room view (for refreshing visuals, etc).
-    Room* getRoomView() { return roomView; }
+    // Returns the room if it's on the scene stack (for refreshing visuals, etc), otherwise nullptr.
+    Room* getRoomView() { return scenes.find<Room>(gameStateName(GameState::RoomView)); }
+
+    // Returns the frame pacer (frame time percentiles).
+    const FramePacer& getFramePacer() const { return pacer; }
 
 private:
     // ==== Core SFML ====
     sf::RenderWindow window;       // The main game window.
-    sf::Font font;                 // Game UI font (loaded once at startup).
+    std::shared_ptr<sf::Font> font; // Game UI font (borrowed from the AssetCache at startup).
     sf::Clock frameClock;          // Clock for frame timing (delta time).
+    float accumulator = 0.f;       // Frame time not yet consumed by fixed simulation steps.
+    FramePacer pacer;              // Holds the loop to the frame cap and records frame times.
+    Renderer renderer;             // Draws the recorded frames on the render thread (letterboxed, world pass scaled).
+    bool focused = true;           // False while the window is in the background (throttled to a few fps).
+    bool needsRedraw = true;       // A static screen has something new to show.
+    GameState renderedState = GameState::StartMenu; // State of the last drawn frame (a switch always redraws).
+
+    // ==== Asset streaming ====
+    std::function<void()> pendingOpen; // View switch waiting for its assets to finish loading (empty if none).
+    AssetList pendingAssets;           // Assets pendingOpen is waiting for.
+    Preloader preloader;               // Loads the screen the player is likely to open next.
+    Settings settings;                 // Options from settings.json (texture budget, ...).
+    TextCache texts;                   // Laid-out titles, labels and the coin counter, kept between frames.
 
     // ==== Game State ====
     GameState state;               // Current screen/game state.
@@ -82,89 +96,85 @@ private:
     // ==== Menu (Start/Menu) ====
     std::vector<sf::Text> menuItems;   // Start menu text options.
     int selectedIndex = 0;             // Highlighted option in the main menu.
-    sf::Texture startMenuBgTexture;    // Start menu background image.
+    std::shared_ptr<sf::Texture> startMenuBgTexture; // Start menu background image.
     sf::Sprite startMenuBgSprite;      // Sprite for the start menu background.
 
     // Start menu confirmation popup
     bool showingNewGameConfirm = false;  // True if new game confirmation is open.
     int confirmIndex = 0;                // "Yes"/"No" selected in confirmation.
 
-    // ==== Key State (for continuous movement) ====
-    std::map<sf::Keyboard::Key, bool> keyState;  // Tracks held-down keys for movement.
-
-    // ==== Views & UI Screens ====
-    Room* roomView = nullptr;                   // Main room view.
-    Aquarium* aquariumView = nullptr;           // Fullscreen aquarium.
-    Shelf* shelfView = nullptr;                 // Fullscreen shelf view.
-    StorageRack* storageRackView = nullptr;     // Hat equip view.
-    Computer* computerView = nullptr;           // Desktop view.
-    ShopCategoryView* shopCategoryView = nullptr;// Category selection menu.
-
-    // Shop screens
-    HatShopView* hatShopView = nullptr;         // Hat shop UI.
-    ShelfShopView* shelfShopView = nullptr;     // Shelf decorations shop.
-    FishTankShopView* fishTankShopView = nullptr;// Fish tank shop.
-    MiniGameShopView* miniGameShopView = nullptr;// Mini-games shop.
-
-    // ==== Mini Games ====
-    SnakeGame* snakeGame = nullptr;   // Pointer to Snake mini-game, if active.
-    CatchGame* catchGame = nullptr;   // Pointer to Catch mini-game, if active.
-    DodgeGame* dodgeGame = nullptr;   // Pointer to Dodge mini-game, if active.
-
-    // ==== Menu/Selection indices (various UI screens) ====
-    int computerSelectionIndex = 0;           // Highlight in computer view.
-    std::vector<sf::Text> computerOptions;    // Computer desktop option labels.
-
-    int storageSelectionIndex = 0;            // Storage rack selection.
-    std::vector<sf::Text> storageOptions;
-
-    int shelfSelectionIndex = 0;              // Shelf selection.
-    std::vector<sf::Text> shelfOptions;
-
-    int shopSelectionIndex = 0;               // Shop category menu selection.
-    std::vector<sf::Text> shopVisualItems;
-
-    // Shop categories (for navigation)
-    enum class ShopCategory {
-        Hat,
-        Shelf,
-        FishTank,
-        MiniGame
+    // ==== Input ====
+    InputThread inputThread;           // Samples the action keys and queues timestamped changes.
+    InputState input;                  // Keys held/pressed/released in the current step (from inputThread's queue).
+    sf::Int64 unpresentedInput = -1;   // Stamp of the oldest key press stepped since the last submitted frame (-1 = none).
+
+    // ==== Views, shops & minigames ====
+    // The room, the views and shops opened from it, top scene shown; state follows the top.
+    // Closed scenes stay suspended in the stack's pool, so reopening one is instant.
+    SceneStack scenes;
+    // The minigame being played, over the computer (built from MiniGameRegistry; nullptr when none is).
+    std::unique_ptr<MiniGameBase> activeMiniGame;
+
+    // ==== Per-state dispatch ====
+    // What one GameState does with a key press, a simulation step and a frame; a nullptr entry does nothing.
+    struct StateHandlers {
+        void (*onKey)(GameManager& gm, const sf::Event& event) = nullptr;             // Key pressed.
+        void (*update)(GameManager& gm, float dt) = nullptr;                          // One simulation step.
+        void (*renderWorld)(GameManager& gm, DrawList& target, float alpha) = nullptr; // Scaled world pass.
+        void (*renderUi)(GameManager& gm, DrawList& target, float alpha) = nullptr;    // Native-resolution UI.
     };
-    std::vector<std::pair<sf::Text, ShopCategory>> shopCategoryOptions;
-    int shopCategoryIndex = 0;
+    // Handlers indexed by GameState, so events, update and render make one call instead of a switch each.
+    static const std::array<StateHandlers, GAME_STATE_COUNT> stateHandlers;
+    static std::array<StateHandlers, GAME_STATE_COUNT> buildStateHandlers();
+    // Returns the handlers of the current state.
+    const StateHandlers& currentHandlers() const { return stateHandlers[static_cast<std::size_t>(state)]; }
+
+    // Passes a key press to the top scene (if it's a T) and closes the scene if it asked to.
+    template<typename T>
+    static void forwardKey(GameManager& gm, const sf::Event& event);
 
     // ==== Core logic helpers ====
     void processEvents();            // Polls SFML events and dispatches them.
-    void render();                   // Draws the currently active view.
-    void renderStartMenu();          // Draws the start menu UI.
+    void consumeInput(sf::Int64 until); // Starts an input step: applies the queued key changes stamped up to until.
+    void handleEvent(const sf::Event& event); // Dispatches one event to the current screen.
+    void updatePacing();             // Picks the pacer's target from the settings and window focus.
+    void updateSampling();           // Samples keys only while an animated screen has focus (InputThread::setEnabled).
+    void waitForEvents();            // On static screens, sleeps until an event arrives (or briefly, while assets load).
+    void render(float alpha);        // Records the currently active view, alpha (0-1) of the way into the next step, and submits it.
+    void renderWorld(DrawList& target, float alpha); // Draws the current screen's pictures (the scaled world pass).
+    void renderStartMenu(DrawList& window); // Draws the start menu options and popup (the background is in renderWorld).
     void updateStartMenu();          // Updates start menu highlight.
-    void loadFont();                 // Loads the game's font from file.
+    void loadFont();                 // Loads the game's font from file and lays out its glyphs.
+    void closeWindow();              // Stops the render thread and closes the window.
     void initMenu();                 // Initializes menu options/texts.
     void moveUp();                   // Moves highlight up in menu.
     void moveDown();                 // Moves highlight down in menu.
     void selectOption();             // Handles selection/activation in menus.
-    void handleContinuousMovement(); // Handles WASD/arrow-key walking in room.
+    // Runs open() once every asset in the list is loaded; until then the current screen stays up with a loading label.
+    void openWhenLoaded(const AssetList& assets, std::function<void()> open);
+    void renderLoadingOverlay(DrawList& window); // Draws the "Loading..." label while a view switch waits for assets.
+    void updatePreloadTarget();      // Points the preloader at the screen the current selection/position leads to.
+
+    // ==== Scene helpers ====
+    // Shows the scene for target, resuming the suspended one (pooled under key, by default the state's name)
+    // or pushing the one create() builds.
+    void openScene(GameState target, const std::function<std::unique_ptr<Scene>()>& create);
+    void openScene(GameState target, const std::string& key, const std::function<std::unique_ptr<Scene>()>& create);
+    void closeScene();               // Suspends the top scene and shows the one under it (the start menu if none).
+    bool closeRequestedScene();      // Closes the top scene if it asked to; returns true if it did.
+    void startRoom();                // Drops every scene and opens a fresh room (new or loaded save).
+
+    // ==== Room helpers ====
+    void openRoomObject(int object); // Opens the view of a room object (RoomSim::ObjectId); the doors go back to the menu.
 
     // ==== Mini Game helpers ====
-    void initMiniGame();             // Initializes minigame (legacy/unused).
-    void renderMiniGame();           // Renders a generic minigame placeholder.
-
-    // ==== Shop Navigation (templated) ====
-    template<typename T>
-    void handleShopNavigationInput(sf::Keyboard::Key key, int& selectionIndex, const std::vector<T>& items);
+    void startMiniGame(const std::string& id); // Fills the minigame slot with a new game from the registry and shows it.
+    void closeMiniGame();            // Empties the minigame slot and goes back to the scene under it.
 
     // ==== Input handlers for all game states ====
     void processStartMenuEvents(const sf::Event& event);
     void processRoomViewEvents(const sf::Event& event);
     void processComputerViewEvents(const sf::Event& event);
-    void processStorageViewEvents(const sf::Event& event);
-    void processHatShopEvents(const sf::Event& event);
     void processMiniGameEvents(const sf::Event& event);
-    void processShelfViewEvents(const sf::Event& event);
     void processShopCategoryViewEvents(const sf::Event& event);
-    void processShelfShopEvents(const sf::Event& event);
-    void processAquariumViewEvents(const sf::Event& event);
-    void processFishTankShopEvents(const sf::Event& event);
-    void processMiniGameShopEvents(const sf::Event& event);
 };
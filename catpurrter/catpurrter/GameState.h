@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef>
+
+// GameState represents all possible game screens/modes.
+enum class GameState {
+    StartMenu,         // Main menu (new/load/exit)
+    RoomView,          // Player's main room view
+    ComputerView,      // Computer desktop (apps, minigames, shops)
+    StorageView,       // Storage rack (hat equip view)
+    ShelfView,         // Big shelf (shows bought decorations)
+    ShopCategoryView,  // Menu for choosing which shop
+    HatShop,           // Hat shop UI
+    ShelfShop,         // Shelf decorations shop UI
+    FishTankShop,      // Aquarium decorations/fish shop UI
+    MiniGameShop,      // Mini-games shop UI
+    AquariumView,      // Fullscreen aquarium view
+    MiniGame           // Any active mini-game
+};
+
+// Number of GameState values (size of tables indexed by state).
+const std::size_t GAME_STATE_COUNT = static_cast<std::size_t>(GameState::MiniGame) + 1;
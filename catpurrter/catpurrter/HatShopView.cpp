@@ -20,34 +20,18 @@ HatShopView::HatShopView(sf::Font& font, Player& player, GameManager* gm)
 }
 
 void HatShopView::init() {
-    hatOptions.clear();
-    float y = 150.f;
-
-    for (const auto& hat : hats) {
-        sf::Text option;
-        option.setFont(font);
-        option.setCharacterSize(28);
-        option.setPosition(100.f, y);
-        hatOptions.push_back(option);
-        y += 50.f;
-    }
-
-    updateOptionColors();
+    optionList.setup(font, 28, { 100.f, 150.f }, 50.f);
+    refreshOptions();
 }
 
 void HatShopView::handleInput(sf::Keyboard::Key key) {
     if (key == sf::Keyboard::Escape) {
-        closeFlag = true;
+        requestClose();
         return;
     }
 
-    if (key == sf::Keyboard::Up || key == sf::Keyboard::W) {
-        if (selectedIndex > 0) selectedIndex--;
-    }
-    else if (key == sf::Keyboard::Down || key == sf::Keyboard::S) {
-        if (selectedIndex < static_cast<int>(hats.size()) - 1) selectedIndex++;
-    }
-    else if (key == sf::Keyboard::Enter) {
+    if (optionList.handleKey(key)) {
+        const int selectedIndex = optionList.getSelected();
         const std::string& selectedId = std::get<0>(hats[selectedIndex]);
         int price = std::get<2>(hats[selectedIndex]);
 
@@ -59,23 +43,23 @@ void HatShopView::handleInput(sf::Keyboard::Key key) {
         else if (playerData.coins >= price) {
             playerData.coins -= price;
             playerData.unlockedHats.push_back(selectedId);
+            playerData.markInventoryChanged();
             std::thread saveThread([&]() {
                 playerData.saveToFile("saves/save.json");
                 });
             saveThread.detach();
             std::cout << "Bought hat: " << selectedId << " for " << price << " coins\n";
-            updateOptionColors();
+            refreshOptions();
         }
         else {
             std::cout << "Not enough coins\n";
         }
     }
-
-    updateOptionColors();
 }
 
 
-void HatShopView::updateOptionColors() {
+void HatShopView::refreshOptions() {
+    std::vector<std::string> labels;
     for (size_t i = 0; i < hats.size(); ++i) {
         const auto& [id, label, price] = hats[i];
 
@@ -85,28 +69,19 @@ void HatShopView::updateOptionColors() {
         if (owned)
             display += " (Owned)";
 
-        hatOptions[i].setString(display);
-        hatOptions[i].setFillColor(i == selectedIndex ? sf::Color::Yellow : sf::Color::White);
+        labels.push_back(display);
     }
+    optionList.setItems(labels);
 }
 
 
-void HatShopView::render(sf::RenderWindow& window) {
-    sf::RectangleShape bg(sf::Vector2f(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y)));
+void HatShopView::render(DrawList& window) {
+    sf::RectangleShape bg(window.getView().getSize());
     bg.setFillColor(sf::Color(120, 60, 200));
     window.draw(bg);
 
     gameManager->drawSectionTitle(window, font, "Hat Shop");
     gameManager->drawCoinDisplay(window, font, playerData.coins);
 
-    for (const auto& opt : hatOptions)
-        window.draw(opt);
-}
-
-bool HatShopView::shouldClose() const {
-    return closeFlag;
-}
-
-void HatShopView::resetCloseFlag() {
-    closeFlag = false;
+    optionList.render(window);
 }
@@ -18,21 +18,13 @@ public:
     void handleInput(sf::Keyboard::Key key) override;
 
     // Draws the hat shop background, menu, and all options.
-    void render(sf::RenderWindow& window) override;
-
-    // Returns true if the player requested to close/exit the shop.
-    bool shouldClose() const override;
-
-    // Resets the close flag so the view can be reopened.
-    void resetCloseFlag() override;
+    void render(DrawList& window) override;
 
 private:
     // List of hats for sale: tuple of (id, display name, price)
     std::vector<std::tuple<std::string, std::string, int>> hats;
 
-    // Text for displaying each hat option on screen
-    std::vector<sf::Text> hatOptions;
 
-    // Updates menu option colors and ownership status text.
-    void updateOptionColors() override;
+    // Rebuilds the option labels, marking the ones already owned.
+    void refreshOptions() override;
 };
@@ -0,0 +1,150 @@
+#include "ImageScaler.h"
+#include "AssetPack.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+namespace {
+    const std::string CACHE_DIR = "assets/cache";
+
+    // Source pixels covered by one output pixel along an axis, and how much of each.
+    struct Span {
+        unsigned first = 0;          // First source pixel.
+        std::vector<float> weights;  // Coverage of first, first + 1, ... (sums to 1).
+    };
+
+    // Splits srcSize source pixels evenly over dstSize output pixels.
+    std::vector<Span> buildSpans(unsigned srcSize, unsigned dstSize) {
+        std::vector<Span> spans(dstSize);
+        const double step = static_cast<double>(srcSize) / dstSize;
+        for (unsigned i = 0; i < dstSize; ++i) {
+            const double start = i * step;
+            const double end = std::min<double>(srcSize, (i + 1) * step);
+            Span& span = spans[i];
+            span.first = static_cast<unsigned>(start);
+            for (unsigned s = span.first; s < srcSize && s < end; ++s) {
+                const double covered = std::min<double>(s + 1, end) - std::max<double>(s, start);
+                if (covered > 0)
+                    span.weights.push_back(static_cast<float>(covered / step));
+            }
+        }
+        return spans;
+    }
+}
+
+sf::Vector2u ImageScaler::scaledSize(sf::Vector2u size, float scale) {
+    unsigned width = static_cast<unsigned>(std::lround(size.x * static_cast<double>(scale)));
+    unsigned height = static_cast<unsigned>(std::lround(size.y * static_cast<double>(scale)));
+    return { std::max(1u, width), std::max(1u, height) };
+}
+
+bool ImageScaler::downsample(const sf::Image& source, sf::Image& target, sf::Vector2u size) {
+    const sf::Vector2u srcSize = source.getSize();
+    if (size.x == 0 || size.y == 0 || size.x > srcSize.x || size.y > srcSize.y)
+        return false;
+
+    const std::vector<Span> columns = buildSpans(srcSize.x, size.x);
+    const std::vector<Span> rows = buildSpans(srcSize.y, size.y);
+    const std::size_t srcStride = static_cast<std::size_t>(srcSize.x) * 4;
+    const std::size_t dstStride = static_cast<std::size_t>(size.x) * 4;
+
+    // Premultiply once so transparent pixels don't bleed their (often black) colour into edges
+    std::vector<float> premultiplied(srcStride * srcSize.y);
+    const sf::Uint8* pixels = source.getPixelsPtr();
+    for (std::size_t i = 0; i < premultiplied.size(); i += 4) {
+        const float alpha = pixels[i + 3] * (1.f / 255.f);
+        premultiplied[i + 0] = pixels[i + 0] * alpha;
+        premultiplied[i + 1] = pixels[i + 1] * alpha;
+        premultiplied[i + 2] = pixels[i + 2] * alpha;
+        premultiplied[i + 3] = pixels[i + 3];
+    }
+
+    // Horizontal pass: every source row shrinks to the target width
+    std::vector<float> narrow(dstStride * srcSize.y, 0.f);
+    for (unsigned y = 0; y < srcSize.y; ++y) {
+        const float* in = &premultiplied[y * srcStride];
+        float* out = &narrow[y * dstStride];
+        for (unsigned x = 0; x < size.x; ++x) {
+            const Span& span = columns[x];
+            const float* src = in + static_cast<std::size_t>(span.first) * 4;
+            float r = 0.f, g = 0.f, b = 0.f, a = 0.f;
+            for (std::size_t k = 0; k < span.weights.size(); ++k, src += 4) {
+                const float w = span.weights[k];
+                r += src[0] * w;
+                g += src[1] * w;
+                b += src[2] * w;
+                a += src[3] * w;
+            }
+            out[x * 4 + 0] = r;
+            out[x * 4 + 1] = g;
+            out[x * 4 + 2] = b;
+            out[x * 4 + 3] = a;
+        }
+    }
+
+    // Vertical pass: whole rows are blended at once; the inner loop is a plain multiply-add over
+    // contiguous floats, which the compiler vectorizes (SSE/AVX/NEON) without intrinsics
+    std::vector<float> accum(dstStride);
+    std::vector<sf::Uint8> result(dstStride * size.y);
+    for (unsigned y = 0; y < size.y; ++y) {
+        std::fill(accum.begin(), accum.end(), 0.f);
+        const Span& span = rows[y];
+        for (std::size_t k = 0; k < span.weights.size(); ++k) {
+            const float w = span.weights[k];
+            const float* in = &narrow[(span.first + k) * dstStride];
+            float* acc = accum.data();
+            for (std::size_t i = 0; i < dstStride; ++i)
+                acc[i] += in[i] * w;
+        }
+
+        sf::Uint8* out = &result[y * dstStride];
+        for (std::size_t i = 0; i < dstStride; i += 4) {
+            const float alpha = accum[i + 3];
+            const float unpremultiply = alpha > 0.f ? 255.f / alpha : 0.f;
+            for (int c = 0; c < 3; ++c)
+                out[i + c] = static_cast<sf::Uint8>(std::clamp(accum[i + c] * unpremultiply + 0.5f, 0.f, 255.f));
+            out[i + 3] = static_cast<sf::Uint8>(std::clamp(alpha + 0.5f, 0.f, 255.f));
+        }
+    }
+
+    target.create(size.x, size.y, result.data());
+    return true;
+}
+
+bool ImageScaler::loadScaled(const std::string& sourcePath, float scale, sf::Image& target) {
+    std::ifstream in(sourcePath, std::ios::binary);
+    if (!in.is_open()) {
+        std::cout << "Scaler: couldn't read " << sourcePath << "\n";
+        return false;
+    }
+    const std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    // Same source bytes and scale = same result, wherever the file lives
+    char key[48];
+    std::snprintf(key, sizeof(key), "%016llx_%u",
+        static_cast<unsigned long long>(AssetPack::hash(bytes.data(), bytes.size())),
+        static_cast<unsigned>(std::lround(scale * 1000.0)));
+    const std::string cachePath = CACHE_DIR + "/" + key + ".png";
+    if (std::filesystem::exists(cachePath) && target.loadFromFile(cachePath))
+        return true;
+
+    sf::Image source;
+    if (!source.loadFromMemory(bytes.data(), bytes.size())) {
+        std::cout << "Scaler: couldn't decode " << sourcePath << "\n";
+        return false;
+    }
+    if (!downsample(source, target, scaledSize(source.getSize(), scale)))
+        return false;
+
+    std::error_code error;
+    std::filesystem::create_directories(CACHE_DIR, error);
+    if (error || !target.saveToFile(cachePath))
+        std::cout << "Scaler: couldn't write cache entry for " << sourcePath << "\n";
+    return true;
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+
+// ImageScaler makes the room-sized ("small") variants of sprites from their big close-up art,
+// so each item only has to be drawn once.
+// Downsampling is an area-weighted box filter on premultiplied alpha, which handles the
+// non-integer factors we use (1/3, 0.3) without fringes around transparent edges.
+// Results can be cached in assets/cache, keyed by a hash of the source file, so re-baking
+// atlases only rescales art that actually changed.
+class ImageScaler {
+public:
+    // Returns size * scale, rounded to whole pixels (at least 1x1).
+    static sf::Vector2u scaledSize(sf::Vector2u size, float scale);
+
+    // Shrinks source into target at the given size. Returns false if size is empty or bigger than the source.
+    static bool downsample(const sf::Image& source, sf::Image& target, sf::Vector2u size);
+
+    // Loads the file at sourcePath scaled by scale, from the cache if the source is unchanged,
+    // otherwise by decoding and downsampling it (and writing the result to the cache).
+    // Returns false if the source can't be read.
+    static bool loadScaled(const std::string& sourcePath, float scale, sf::Image& target);
+};
@@ -0,0 +1,66 @@
+#include "InputState.h"
+#include <array>
+#include <initializer_list>
+
+namespace {
+    using KeySet = std::bitset<sf::Keyboard::KeyCount>;
+
+    KeySet keys(std::initializer_list<sf::Keyboard::Key> list) {
+        KeySet set;
+        for (sf::Keyboard::Key key : list)
+            set.set(key);
+        return set;
+    }
+}
+
+const InputState::KeySet& InputState::bindings(Action action) {
+    // Indexed by Action; the same keys the menus and the room always used
+    static const std::array<KeySet, static_cast<std::size_t>(Action::Count)> table = {
+        keys({ sf::Keyboard::A, sf::Keyboard::Left }),
+        keys({ sf::Keyboard::D, sf::Keyboard::Right }),
+        keys({ sf::Keyboard::W, sf::Keyboard::Up }),
+        keys({ sf::Keyboard::S, sf::Keyboard::Down }),
+        keys({ sf::Keyboard::Enter, sf::Keyboard::Space }),
+        keys({ sf::Keyboard::Escape })
+    };
+    return table[static_cast<std::size_t>(action)];
+}
+
+std::vector<sf::Keyboard::Key> InputState::boundKeys() {
+    KeySet all;
+    for (std::size_t i = 0; i < static_cast<std::size_t>(Action::Count); ++i)
+        all |= bindings(static_cast<Action>(i));
+    std::vector<sf::Keyboard::Key> result;
+    for (int key = 0; key < sf::Keyboard::KeyCount; ++key) {
+        if (all[key])
+            result.push_back(static_cast<sf::Keyboard::Key>(key));
+    }
+    return result;
+}
+
+void InputState::beginStep() {
+    pressed.reset();
+    released.reset();
+}
+
+void InputState::press(sf::Keyboard::Key key) {
+    if (!valid(key))
+        return;
+    // A key that's already down isn't pressed again
+    if (!held[key])
+        pressed.set(key);
+    held.set(key);
+}
+
+void InputState::release(sf::Keyboard::Key key) {
+    if (!valid(key))
+        return;
+    if (held[key])
+        released.set(key);
+    held.reset(key);
+}
+
+void InputState::releaseAll() {
+    released |= held;
+    held.reset();
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <SFML/Window/Keyboard.hpp>
+#include <bitset>
+#include <cstddef>
+#include <vector>
+
+// What the player can do, independent of which key does it.
+enum class Action {
+    MoveLeft,  // A or Left.
+    MoveRight, // D or Right.
+    MoveUp,    // W or Up.
+    MoveDown,  // S or Down.
+    Confirm,   // Enter or Space.
+    Back,      // Escape.
+    Count      // Number of actions.
+};
+
+// InputState is the keyboard as the simulation sees it during one step: which keys are held, and which went
+// down or up during the step. GameManager fills it from the InputThread's timestamped key changes, each step
+// taking the ones that happened before it ends, so everything that reads it in a step sees the same keys
+// and nothing asks the OS per key. press()/release() drive it directly, without a keyboard.
+class InputState {
+public:
+    // Starts a new step: forgets the pressed/released edges, keeps the held keys.
+    void beginStep();
+
+    // Marks a key as pressed/released this step.
+    void press(sf::Keyboard::Key key);
+    void release(sf::Keyboard::Key key);
+
+    // Releases every held key.
+    void releaseAll();
+
+    // Returns true while the key is down.
+    bool isHeld(sf::Keyboard::Key key) const { return valid(key) && held[key]; }
+    // Returns true if the key went down this step.
+    bool wasPressed(sf::Keyboard::Key key) const { return valid(key) && pressed[key]; }
+    // Returns true if the key went up this step.
+    bool wasReleased(sf::Keyboard::Key key) const { return valid(key) && released[key]; }
+
+    // The same for actions: true if any key bound to the action is held/pressed/released.
+    bool isHeld(Action action) const { return (held & bindings(action)).any(); }
+    bool wasPressed(Action action) const { return (pressed & bindings(action)).any(); }
+    bool wasReleased(Action action) const { return (released & bindings(action)).any(); }
+
+    // Returns true if key is bound to action (for code handling key events one at a time).
+    static bool isBound(Action action, sf::Keyboard::Key key) { return valid(key) && bindings(action)[key]; }
+
+    // Returns every key bound to some action (the keys the InputThread watches).
+    static std::vector<sf::Keyboard::Key> boundKeys();
+
+private:
+    using KeySet = std::bitset<sf::Keyboard::KeyCount>; // One bit per key code.
+
+    // Returns the keys bound to an action.
+    static const KeySet& bindings(Action action);
+
+    // Returns true for key codes that have a bit (not Unknown).
+    static bool valid(sf::Keyboard::Key key) { return key >= 0 && key < sf::Keyboard::KeyCount; }
+
+    KeySet held;     // Keys down right now.
+    KeySet pressed;  // Keys that went down this step.
+    KeySet released; // Keys that went up this step.
+};
@@ -0,0 +1,91 @@
+#include "InputThread.h"
+#include "InputState.h"
+#include <chrono>
+
+InputThread::InputThread(sf::Time interval)
+    : interval(interval), keys(InputState::boundKeys()), down(keys.size(), false) {
+}
+
+InputThread::~InputThread() {
+    stop();
+}
+
+void InputThread::start() {
+    if (thread.joinable())
+        return;
+    stopping = false;
+    thread = std::thread(&InputThread::threadMain, this);
+}
+
+void InputThread::stop() {
+    if (!thread.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_one();
+    thread.join();
+}
+
+void InputThread::setEnabled(bool value) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (enabled == value)
+            return;
+        enabled = value;
+    }
+    wake.notify_one();
+}
+
+bool InputThread::pop(sf::Int64 time, InputEvent& event) {
+    const InputEvent* oldest = queue.front();
+    if (!oldest || oldest->time > time)
+        return false;
+    event = *oldest;
+    queue.pop();
+    return true;
+}
+
+sf::Int64 InputThread::now() {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+bool InputThread::sample(bool reading) {
+    bool recorded = true;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const bool isDown = reading && sf::Keyboard::isKeyPressed(keys[i]);
+        if (isDown == down[i])
+            continue;
+        // A change that doesn't fit stays unrecorded and is retried on the next sample
+        if (!queue.push({ keys[i], isDown, now() })) {
+            ++overflows;
+            recorded = false;
+            continue;
+        }
+        down[i] = isDown;
+    }
+    return recorded;
+}
+
+void InputThread::threadMain() {
+    while (!stopping) {
+        if (enabled) {
+            sample(true);
+            sf::sleep(interval);
+            continue;
+        }
+
+        // Static screen or background window: let go of everything, then sleep until sampling is wanted again
+        while (!stopping && !sample(false))
+            sf::sleep(interval);
+        std::unique_lock<std::mutex> lock(mutex);
+        wake.wait(lock, [this] { return enabled || stopping; });
+        lock.unlock();
+
+        // A key held across the pause (e.g. the Enter that opened a minigame) isn't a new press
+        for (std::size_t i = 0; i < keys.size(); ++i)
+            down[i] = sf::Keyboard::isKeyPressed(keys[i]);
+    }
+}
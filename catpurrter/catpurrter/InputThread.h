@@ -0,0 +1,68 @@
+#pragma once
+#include <SFML/Window.hpp>
+#include "SpscQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A key going down or up, stamped with when the input thread saw it.
+struct InputEvent {
+    sf::Keyboard::Key key = sf::Keyboard::Unknown; // Key that changed.
+    bool pressed = false;                          // True if it went down, false if it went up.
+    sf::Int64 time = 0;                            // When it was seen (InputThread::now(), microseconds).
+};
+
+// InputThread samples the keys bound to actions (InputState::boundKeys) about once a millisecond on a thread
+// of its own and queues every change with its timestamp. Window events only arrive when the main loop gets
+// round to polling them, so a slow frame would delay and bunch them up; the samples keep the real order and
+// timing, and the simulation takes them step by step (GameManager::consumeInput).
+// SFML only delivers window events to the thread that created the window, hence sampling with
+// sf::Keyboard::isKeyPressed rather than reading events here; menus still react to the window's key events.
+class InputThread {
+public:
+    // Creates the sampler (not started yet); interval is the time between samples.
+    explicit InputThread(sf::Time interval = sf::milliseconds(1));
+
+    // Stops the thread.
+    ~InputThread();
+
+    // Starts sampling.
+    void start();
+
+    // Stops sampling and joins the thread.
+    void stop();
+
+    // Samples only while enabled (an animated screen in a focused window). Disabling it queues a release for
+    // every held key and parks the thread until it's enabled again; keys still held then aren't new presses.
+    void setEnabled(bool enabled);
+
+    // Consumer side: takes the oldest queued change stamped at or before time; returns false if there is none.
+    bool pop(sf::Int64 time, InputEvent& event);
+
+    // Returns how many times a change found the queue full (it's retried on the next sample, so arrives late).
+    unsigned getOverflows() const { return overflows.load(); }
+
+    // Returns the time the changes are stamped with: microseconds on a steady clock, shared by every thread.
+    static sf::Int64 now();
+
+private:
+    // Thread body: samples the watched keys until stop(), waiting while disabled.
+    void threadMain();
+
+    // Queues the changes since the last sample (reading = false: every watched key up).
+    // Returns false if some didn't fit in the queue.
+    bool sample(bool reading);
+
+    sf::Time interval;                     // Time between samples.
+    std::vector<sf::Keyboard::Key> keys;   // Keys watched.
+    std::vector<bool> down;                // Last sampled state of each watched key (thread only).
+    SpscQueue<InputEvent, 256> queue;      // Changes not consumed yet.
+    std::atomic<bool> enabled{ false };    // Sampling wanted (see setEnabled).
+    std::atomic<bool> stopping{ false };   // Set by stop().
+    std::mutex mutex;                      // Guards enabled/stopping changes for wake.
+    std::condition_variable wake;          // Wakes the parked thread when enabled or stopping.
+    std::atomic<unsigned> overflows{ 0 };  // Changes that found the queue full.
+    std::thread thread;                    // Sampling thread.
+};
@@ -0,0 +1,11 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+
+// The simulation runs in fixed steps (see GameManager::run), so a frame usually lands between two of them.
+// Views keep each moving thing's position from the previous step and draw it at lerp(previous, current, alpha),
+// where alpha (0-1) is how far the frame is past the last step; motion looks smooth at any frame rate.
+
+// Returns the point alpha of the way from `from` to `to`.
+inline sf::Vector2f lerp(const sf::Vector2f& from, const sf::Vector2f& to, float alpha) {
+    return from + (to - from) * alpha;
+}
@@ -0,0 +1,64 @@
+#include "LayeredSprite.h"
+
+bool LayeredSprite::build(const SpriteAtlas& atlas, const std::string& baseId, const std::vector<std::string>& layerIds) {
+    clear();
+    const AtlasSprite* base = atlas.find(baseId);
+    if (!base)
+        return false;
+
+    size = { static_cast<float>(base->rect.width), static_cast<float>(base->rect.height) };
+    addQuad(*base, { 0.f, 0.f });
+    for (const auto& id : layerIds) {
+        if (const AtlasSprite* layer = atlas.find(id))
+            addQuad(*layer, sf::Vector2f(layer->offset));
+    }
+    return true;
+}
+
+void LayeredSprite::clear() {
+    batches.clear();
+    size = { 0.f, 0.f };
+}
+
+void LayeredSprite::addQuad(const AtlasSprite& sprite, sf::Vector2f position) {
+    // Layers on a different page than the one before start a new batch, keeping the drawing order
+    if (batches.empty() || batches.back().texture != sprite.texture)
+        batches.push_back({ sprite.texture });
+    sf::VertexArray& vertices = batches.back().vertices;
+
+    const sf::IntRect& rect = sprite.rect;
+    const sf::Vector2f size(static_cast<float>(rect.width), static_cast<float>(rect.height));
+    const float left = static_cast<float>(rect.left);
+    const float top = static_cast<float>(rect.top);
+    const float right = left + size.x;
+    const float bottom = top + size.y;
+
+    const sf::Vertex topLeft(position, sf::Vector2f(left, top));
+    const sf::Vertex topRight(position + sf::Vector2f(size.x, 0.f), sf::Vector2f(right, top));
+    const sf::Vertex bottomLeft(position + sf::Vector2f(0.f, size.y), sf::Vector2f(left, bottom));
+    const sf::Vertex bottomRight(position + size, sf::Vector2f(right, bottom));
+    vertices.append(topLeft);
+    vertices.append(topRight);
+    vertices.append(bottomLeft);
+    vertices.append(bottomLeft);
+    vertices.append(topRight);
+    vertices.append(bottomRight);
+}
+
+void LayeredSprite::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    states.transform *= getTransform();
+    for (const Batch& batch : batches) {
+        states.texture = batch.texture.get();
+        target.draw(batch.vertices, states);
+    }
+}
+
+void LayeredSprite::appendTo(SpriteBatch& batch) const {
+    for (const Batch& pageBatch : batches)
+        batch.add(pageBatch.texture.get(), &pageBatch.vertices[0], pageBatch.vertices.getVertexCount(), getTransform());
+}
+
+void LayeredSprite::appendTo(DrawList& list) const {
+    for (const Batch& pageBatch : batches)
+        list.drawTriangles(pageBatch.texture.get(), &pageBatch.vertices[0], pageBatch.vertices.getVertexCount(), getTransform());
+}
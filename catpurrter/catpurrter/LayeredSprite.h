@@ -0,0 +1,45 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "SpriteAtlas.h"
+#include "SpriteBatch.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// LayeredSprite draws a base atlas sprite with layer sprites stacked on it (e.g. an aquarium and
+// the decorations in it). The stack is built once into one vertex array per atlas page, so drawing it
+// is a single draw call when everything shares a page, however many layers there are.
+class LayeredSprite : public sf::Drawable, public sf::Transformable {
+public:
+    // Rebuilds the stack from the base sprite and the layers in drawing order (positioned by their offsets).
+    // Ids missing from the atlas are skipped; returns false if the base is missing.
+    bool build(const SpriteAtlas& atlas, const std::string& baseId, const std::vector<std::string>& layerIds);
+
+    // Removes everything (draws nothing until the next build).
+    void clear();
+
+    // Queues the stack into a sprite batch (with this sprite's transform) instead of drawing it on its own.
+    void appendTo(SpriteBatch& batch) const;
+
+    // Records the stack into a draw list, one run per page.
+    void appendTo(DrawList& list) const;
+
+    // Returns the size of the base sprite in pixels.
+    sf::Vector2f getSize() const { return size; }
+
+private:
+    // Draws every page's quads with the sprite's transform.
+    void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
+
+    // Appends the two triangles of one atlas sprite placed at position.
+    void addQuad(const AtlasSprite& sprite, sf::Vector2f position);
+
+    // Quads that sample the same page texture.
+    struct Batch {
+        std::shared_ptr<sf::Texture> texture;              // Atlas page.
+        sf::VertexArray vertices{ sf::PrimitiveType::Triangles }; // Two triangles per sprite.
+    };
+
+    std::vector<Batch> batches; // One per page used, in first-use order.
+    sf::Vector2f size;          // Base sprite size.
+};
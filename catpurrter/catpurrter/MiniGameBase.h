@@ -1,9 +1,12 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "DrawList.h"
+#include "InputState.h"
+#include "Scene.h"
 
 // MiniGameBase is an abstract interface for all mini-games in your project.
 // It ensures all mini-games support a common set of methods for running, updating, rendering, input, and status.
-class MiniGameBase {
+class MiniGameBase : public Scene {
 public:
     virtual ~MiniGameBase() = default;
 
@@ -12,20 +15,16 @@ public:
 
     // Updates game logic.
     // dt: time elapsed since last frame (seconds).
-    virtual void update(float dt) = 0;
+    // input: the keys held this frame (moving is polled from here; menus react to key events in handleInput).
+    virtual void update(float dt, const InputState& input) = 0;
 
     // Draws the current game state (UI, game objects, menus, etc).
-    virtual void render(sf::RenderWindow& window) = 0;
+    // alpha: how far (0-1) the frame lies between the last two update steps, for interpolating moving objects.
+    virtual void render(DrawList& window, float alpha) = 0;
 
     // Handles keyboard input for game control, menus, etc.
     virtual void handleInput(sf::Keyboard::Key key) = 0;
 
-    // Returns true if the player requested to exit/close the mini-game.
-    virtual bool shouldClose() const = 0;
-
-    // Resets the close flag so the game can be replayed/reopened.
-    virtual void resetCloseFlag() = 0;
-
     // Returns the number of coins earned in the most recent play session.
     virtual int getCoinsEarned() const = 0;
 
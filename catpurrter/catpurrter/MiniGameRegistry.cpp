@@ -0,0 +1,23 @@
+#include "MiniGameRegistry.h"
+
+MiniGameRegistry& MiniGameRegistry::instance() {
+    static MiniGameRegistry registry;
+    return registry;
+}
+
+bool MiniGameRegistry::add(const std::string& id, const std::string& title, Factory factory) {
+    entries[id] = { title, std::move(factory) };
+    return true;
+}
+
+std::unique_ptr<MiniGameBase> MiniGameRegistry::create(const std::string& id, const sf::Font& font, Player& player, GameManager& gm) const {
+    auto it = entries.find(id);
+    if (it == entries.end())
+        return nullptr;
+    return it->second.factory(font, player, gm);
+}
+
+std::string MiniGameRegistry::getTitle(const std::string& id) const {
+    auto it = entries.find(id);
+    return it != entries.end() ? it->second.title : id;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "MiniGameBase.h"
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+
+class Player;
+class GameManager;
+
+// MiniGameRegistry knows every minigame by the id stored in Player::ownedMiniGames ("snake", "catch", ...).
+// Each game adds itself from its own .cpp, so GameManager and the computer never name a game:
+// they look the id up here to get its title or a fresh instance.
+class MiniGameRegistry {
+public:
+    // Builds a game, ready to play.
+    using Factory = std::function<std::unique_ptr<MiniGameBase>(const sf::Font&, Player&, GameManager&)>;
+
+    // Returns the registry (created on first use, so games can register during static initialization).
+    static MiniGameRegistry& instance();
+
+    // Registers a game under id with the title shown on the computer. Returns true (for static registration).
+    bool add(const std::string& id, const std::string& title, Factory factory);
+
+    // Builds the game registered under id; nullptr if there is none.
+    std::unique_ptr<MiniGameBase> create(const std::string& id, const sf::Font& font, Player& player, GameManager& gm) const;
+
+    // Returns the title of the game registered under id (the id itself if it's unknown).
+    std::string getTitle(const std::string& id) const;
+
+private:
+    // A registered game.
+    struct Entry {
+        std::string title; // Display name, e.g. "Catch Game".
+        Factory factory;   // Builds the game.
+    };
+
+    std::map<std::string, Entry> entries; // Registered games by id.
+};
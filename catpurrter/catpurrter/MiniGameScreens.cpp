@@ -0,0 +1,81 @@
+#include "MiniGameScreens.h"
+
+namespace {
+    sf::Vector2f centerOf(const sf::FloatRect& area) {
+        return { area.left + area.width / 2.f, area.top + area.height / 2.f };
+    }
+
+    std::string gameOverMessage(int coins) {
+        return "Game Over! Coins earned: " + std::to_string(coins);
+    }
+}
+
+void MiniGameScreens::build(const sf::Font& font, const MiniGameScreensSpec& spec) {
+    // Main menu
+    const sf::Vector2f menuCenter = centerOf(spec.menuArea);
+    menuPanel.setup(spec.menuArea, sf::Color(80, 0, 120, 230));
+    hasMenuResult = spec.menuShowsLastResult;
+    if (hasMenuResult) {
+        menuResultLabel = menuPanel.addLabel(font, gameOverMessage(0), 28, sf::Color::White, menuCenter);
+        menuPanel.setLabelVisible(menuResultLabel, false);
+    }
+    menu.setup(font, spec.title, { "Play", "Instructions", "Exit" }, menuCenter, VerticalMenu::Style());
+
+    // How to play: title above the centre, text block under it
+    instructionsPanel.setup(spec.menuArea, sf::Color(80, 0, 120, 230));
+    const float titleY = menuCenter.y - 90.f;
+    std::size_t title = instructionsPanel.addLabel(font, spec.instructionsTitle, 38, sf::Color::Cyan, { menuCenter.x, titleY });
+    const float infoY = titleY + instructionsPanel.getLabelBounds(title).height / 2.f + 30.f;
+    instructionsPanel.addLabel(font, spec.instructions, 22, sf::Color::White, { menuCenter.x, infoY }, LabelAnchor::TopCenter);
+
+    // Pause
+    const sf::FloatRect pauseArea(spec.pausePosition, { 300.f, 120.f });
+    pausePanel.setup(pauseArea, sf::Color(120, 0, 80, 230), sf::Color::Yellow, 2.f);
+    pausePanel.addLabel(font, "Paused", 32, sf::Color::White, { pauseArea.left + pauseArea.width / 2.f, pauseArea.top + 30.f });
+    ChoiceBar::Style pauseStyle;
+    pauseStyle.cellWidth = pauseArea.width / 2.f;
+    pauseStyle.normalColor = sf::Color(180, 80, 200);
+    pauseStyle.selectedColor = sf::Color(230, 200, 40);
+    pauseBar.setup(font, { "Resume", "Exit" }, { pauseArea.left + pauseArea.width / 2.f, pauseArea.top + 80.f }, pauseStyle);
+
+    // Game over
+    const sf::Vector2f overCenter = centerOf(spec.gameOverArea);
+    gameOverPanel.setup(spec.gameOverArea, sf::Color(60, 0, 30, 230));
+    gameOverLabel = gameOverPanel.addLabel(font, gameOverMessage(0), 36, sf::Color(255, 80, 80), { overCenter.x, overCenter.y - 60.f });
+    gameOverBar.setup(font, { "Restart", "Back to Menu" }, { overCenter.x, overCenter.y + 10.f }, ChoiceBar::Style());
+
+    menu.setSelected(0);
+    pauseBar.setSelected(0);
+    gameOverBar.setSelected(0);
+}
+
+void MiniGameScreens::setCoinsEarned(int coins) {
+    const std::string message = gameOverMessage(coins);
+    gameOverPanel.setLabel(gameOverLabel, message);
+    if (hasMenuResult)
+        menuPanel.setLabel(menuResultLabel, message);
+}
+
+void MiniGameScreens::setShowLastResult(bool show) {
+    if (hasMenuResult)
+        menuPanel.setLabelVisible(menuResultLabel, show);
+}
+
+void MiniGameScreens::drawMenu(DrawList& target) const {
+    menuPanel.render(target);
+    menu.render(target);
+}
+
+void MiniGameScreens::drawInstructions(DrawList& target) const {
+    instructionsPanel.render(target);
+}
+
+void MiniGameScreens::drawPause(DrawList& target) const {
+    pausePanel.render(target);
+    pauseBar.render(target);
+}
+
+void MiniGameScreens::drawGameOver(DrawList& target) const {
+    gameOverPanel.render(target);
+    gameOverBar.render(target);
+}
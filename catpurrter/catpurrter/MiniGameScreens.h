@@ -0,0 +1,58 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <string>
+#include "Widgets.h"
+
+// MiniGameScreensSpec describes the screens every minigame has, as data: the main menu, the
+// how-to-play page, the pause bar and the game-over popup. The games only differ in texts and sizes.
+struct MiniGameScreensSpec {
+    std::string title;              // Main menu title ("Snake Minigame").
+    std::string instructionsTitle;  // How-to-play title.
+    std::string instructions;       // How-to-play text (multi-line).
+    sf::FloatRect menuArea;         // Main menu and how-to-play panel.
+    sf::FloatRect gameOverArea;     // Game-over panel.
+    sf::Vector2f pausePosition;     // Top-left corner of the 300x120 pause panel.
+    bool menuShowsLastResult = false; // The main menu repeats the last game-over message.
+};
+
+// MiniGameScreens holds the widgets built from a MiniGameScreensSpec. Everything is laid out once in
+// build(); games drive the selection through the widgets' handleKey and draw the screen they're on.
+class MiniGameScreens {
+public:
+    // Main menu options, in order.
+    enum MenuOption { Play = 0, Instructions = 1, Exit = 2 };
+
+    // Builds all the screens.
+    void build(const sf::Font& font, const MiniGameScreensSpec& spec);
+
+    // Updates the coins shown on the game-over popup (and the menu, if it shows the last result).
+    void setCoinsEarned(int coins);
+
+    // Shows or hides the last result on the main menu (only if the spec asked for it).
+    void setShowLastResult(bool show);
+
+    // Draws the main menu panel.
+    void drawMenu(DrawList& target) const;
+
+    // Draws the how-to-play panel.
+    void drawInstructions(DrawList& target) const;
+
+    // Draws the pause panel over the game.
+    void drawPause(DrawList& target) const;
+
+    // Draws the game-over popup.
+    void drawGameOver(DrawList& target) const;
+
+    VerticalMenu menu;   // Play / Instructions / Exit.
+    ChoiceBar pauseBar;  // Resume / Exit.
+    ChoiceBar gameOverBar; // Restart / Back to Menu.
+
+private:
+    Popup menuPanel;          // Main menu background (and the last result).
+    Popup instructionsPanel;  // How-to-play page.
+    Popup pausePanel;         // Pause background and title.
+    Popup gameOverPanel;      // Game-over background and message.
+    std::size_t menuResultLabel = 0;  // "Game Over! ..." label on menuPanel.
+    std::size_t gameOverLabel = 0;    // "Game Over! ..." label on gameOverPanel.
+    bool hasMenuResult = false;       // menuPanel has the result label.
+};
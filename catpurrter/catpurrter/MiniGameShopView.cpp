@@ -21,22 +21,12 @@ MiniGameShopView::MiniGameShopView(sf::Font& font, Player& player, GameManager*
 }
 
 void MiniGameShopView::init() {
-    gameOptions.clear();
-    float y = 150.f;
-
-    for (const auto& [id, name, price] : games) {
-        sf::Text option;
-        option.setFont(font);
-        option.setCharacterSize(28);
-        option.setPosition(100.f, y);
-        gameOptions.push_back(option);
-        y += 50.f;
-    }
-
-    updateOptionColors();
+    optionList.setup(font, 28, { 100.f, 150.f }, 50.f);
+    refreshOptions();
 }
 
-void MiniGameShopView::updateOptionColors() {
+void MiniGameShopView::refreshOptions() {
+    std::vector<std::string> labels;
     for (size_t i = 0; i < games.size(); ++i) {
         const auto& [id, name, price] = games[i];
         bool owned = std::ranges::find(playerData.ownedMiniGames, id) != playerData.ownedMiniGames.end();
@@ -44,25 +34,20 @@ void MiniGameShopView::updateOptionColors() {
         std::string label = name + " - " + std::to_string(price) + " coins";
         if (owned) label += " (Owned)";
 
-        gameOptions[i].setString(label);
-        gameOptions[i].setFillColor(i == selectedIndex ? sf::Color::Yellow : sf::Color::White);
+        labels.push_back(label);
     }
+    optionList.setItems(labels);
 }
 
 void MiniGameShopView::handleInput(sf::Keyboard::Key key) {
     if (key == sf::Keyboard::Escape) {
-        closeFlag = true;
+        requestClose();
         return;
     }
 
 
-    if (key == sf::Keyboard::Up || key == sf::Keyboard::W) {
-        if (selectedIndex > 0) selectedIndex--;
-    }
-    else if (key == sf::Keyboard::Down || key == sf::Keyboard::S) {
-        if (selectedIndex < static_cast<int>(games.size()) - 1) selectedIndex++;
-    }
-    else if (key == sf::Keyboard::Enter) {
+    if (optionList.handleKey(key)) {
+        const int selectedIndex = optionList.getSelected();
         const auto& [id, label, price] = games[selectedIndex];
 
         bool owned = std::ranges::find(playerData.ownedMiniGames, id) != playerData.ownedMiniGames.end();
@@ -73,41 +58,28 @@ void MiniGameShopView::handleInput(sf::Keyboard::Key key) {
         else if (playerData.coins >= price) {
             playerData.coins -= price;
             playerData.ownedMiniGames.push_back(id);
+            playerData.markInventoryChanged();
             std::thread saveThread([&]() {
                 playerData.saveToFile("saves/save.json");
                 });
             saveThread.detach();
             std::cout << "Bought mini game: " << id << "\n";
-            updateOptionColors();
+            refreshOptions();
         }
         else {
             std::cout << "Not enough coins\n";
         }
     }
-
-    updateOptionColors();
 }
 
 
-void MiniGameShopView::render(sf::RenderWindow& window) {
-    sf::RectangleShape bg(sf::Vector2f(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y)));
+void MiniGameShopView::render(DrawList& window) {
+    sf::RectangleShape bg(window.getView().getSize());
     bg.setFillColor(sf::Color(120, 60, 200));
     window.draw(bg);
 
     gameManager->drawSectionTitle(window, font, "Mini Game Shop");
     gameManager->drawCoinDisplay(window, font, playerData.coins);
 
-    for (const auto& option : gameOptions) {
-        window.draw(option);
-    }
-}
-
-
-bool MiniGameShopView::shouldClose() const {
-    return closeFlag;
+    optionList.render(window);
 }
-
-void MiniGameShopView::resetCloseFlag() {
-    closeFlag = false;
-}
-
@@ -14,24 +14,16 @@ public:
     void init() override;
 
     // Draws the shop background, menu options, and coin balance.
-    void render(sf::RenderWindow& window) override;
+    void render(DrawList& window) override;
 
     // Handles keyboard input for navigating options, buying, and exiting.
     void handleInput(sf::Keyboard::Key key) override;
 
-    // Returns true if the player requested to close this shop.
-    bool shouldClose() const override;
-
-    // Resets the close flag so the view can be reopened.
-    void resetCloseFlag() override;
-
 private:
     // List of games for sale: tuple of (id, display name, price)
     std::vector<std::tuple<std::string, std::string, int>> games;
 
-    // Text for displaying each game option on screen
-    std::vector<sf::Text> gameOptions;
 
-    // Updates option colors and ownership status.
-    void updateOptionColors() override;
+    // Rebuilds the option labels, marking the ones already owned.
+    void refreshOptions() override;
 };
@@ -66,6 +66,7 @@ bool Player::loadFromFile(const std::string& filename) {
     for (const auto& game : data["ownedMiniGames"])
         ownedMiniGames.push_back(game);
 
+    markInventoryChanged();
     return true;
 }
 
@@ -18,12 +18,16 @@ public:
     std::vector<std::string> shelfContents;   // Which shelf decorations are currently placed/displayed.
     std::vector<std::string> aquariumContents;// Fish and decorations the player owns for their aquarium.
     std::vector<std::string> ownedMiniGames;  // Which mini-games the player has bought/unlocked.
+    unsigned inventoryVersion = 0;            // Bumped by markInventoryChanged(); views compare it to know when to rebuild what they show.
 
     // --- Constructors ---
 
     // Initializes a new player with default starting state.
     Player();
 
+    // Call after changing owned, placed or equipped items.
+    void markInventoryChanged() { ++inventoryVersion; }
+
     // --- Persistence Methods ---
 
     // Loads all player data from the given save file (returns true on success).
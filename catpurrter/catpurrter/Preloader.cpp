@@ -0,0 +1,57 @@
+#include "Preloader.h"
+#include <algorithm>
+
+Preloader::Preloader(std::size_t capacity)
+    : capacity(std::max<std::size_t>(1, capacity)) {
+}
+
+void Preloader::setTarget(const std::string& key, const AssetList& assets) {
+    if (key == target)
+        return;
+    target = key;
+
+    auto it = std::find_if(recent.begin(), recent.end(), [&](const Entry& entry) { return entry.key == key; });
+    if (it != recent.end()) {
+        // Seen recently: move it to the front, its assets are cached or still on the way
+        Entry entry = *it;
+        recent.erase(it);
+        recent.push_front(entry);
+    }
+    else {
+        recent.push_front({ key, assets });
+    }
+    AssetCache::instance().prefetch(assets);
+
+    while (recent.size() > capacity) {
+        Entry oldest = recent.back();
+        recent.pop_back();
+        release(oldest);
+    }
+}
+
+void Preloader::clearTarget() {
+    target.clear();
+}
+
+void Preloader::release(const Entry& entry) {
+    auto sharedWithRecent = [this](const std::vector<std::string> AssetList::* field, const std::string& name) {
+        return std::any_of(recent.begin(), recent.end(), [&](const Entry& other) {
+            const auto& names = other.assets.*field;
+            return std::find(names.begin(), names.end(), name) != names.end();
+        });
+    };
+
+    AssetList unused;
+    for (const auto& path : entry.assets.textures) {
+        if (!sharedWithRecent(&AssetList::textures, path))
+            unused.textures.push_back(path);
+    }
+    for (const auto& name : entry.assets.atlases) {
+        if (!sharedWithRecent(&AssetList::atlases, name))
+            unused.atlases.push_back(name);
+    }
+
+    AssetCache& cache = AssetCache::instance();
+    cache.cancelPrefetch(unused);
+    cache.evict(unused);
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include "AssetCache.h"
+#include <deque>
+#include <string>
+
+// Preloader starts loading the screen the player is most likely to open next
+// (the object they're standing next to, the highlighted menu entry) so Enter switches instantly.
+// It remembers only the last few targets: older speculative loads are cancelled and their assets
+// evicted (unless a view is using them), so walking around the room doesn't keep everything resident.
+class Preloader {
+public:
+    // Creates a preloader that keeps the assets of at most `capacity` recent targets around.
+    explicit Preloader(std::size_t capacity = 2);
+
+    // Sets the screen to preload. key names the screen (e.g. "Aquarium"); calling again with the same key does nothing.
+    void setTarget(const std::string& key, const AssetList& assets);
+
+    // Nothing is likely next; already preloaded targets are kept until they fall out of the history.
+    void clearTarget();
+
+    // Returns the key of the current target, or an empty string.
+    const std::string& getTarget() const { return target; }
+
+private:
+    // One preloaded screen.
+    struct Entry {
+        std::string key;   // Screen name.
+        AssetList assets;  // What was prefetched for it.
+    };
+
+    // Cancels and evicts an entry's assets that no remaining entry shares.
+    void release(const Entry& entry);
+
+    std::size_t capacity;      // Maximum number of targets kept in recent.
+    std::string target;        // Current target key ("" if none).
+    std::deque<Entry> recent;  // Recent targets, newest first.
+};
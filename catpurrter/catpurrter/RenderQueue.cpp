@@ -0,0 +1,15 @@
+#include "RenderQueue.h"
+
+#include <algorithm>
+
+void RenderQueue::add(float depth, Submit submit) {
+    items.push_back({ depth, std::move(submit) });
+}
+
+void RenderQueue::flush() {
+    std::stable_sort(items.begin(), items.end(),
+        [](const Item& a, const Item& b) { return a.depth < b.depth; });
+    for (const Item& item : items)
+        item.submit();
+    items.clear();
+}
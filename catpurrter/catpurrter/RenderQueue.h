@@ -0,0 +1,29 @@
+#pragma once
+#include <functional>
+#include <vector>
+
+// RenderQueue orders the things standing on the room floor by depth, so whatever is lower on
+// screen (closer to the viewer) covers what is behind it. Each item is submitted with a depth key
+// (the player's feet Y, the bottom edge of a piece of furniture) and a callback that draws it
+// (usually by queueing sprites into a SpriteBatch). One stable sort per frame then layers any number
+// of occluders correctly; items with equal depth keep their submission order.
+class RenderQueue {
+public:
+    // Draws one item.
+    using Submit = std::function<void()>;
+
+    // Adds an item at the given depth (larger = closer to the viewer, drawn later).
+    void add(float depth, Submit submit);
+
+    // Sorts the items by depth, calls them back to front and empties the queue.
+    void flush();
+
+private:
+    // One submitted item.
+    struct Item {
+        float depth = 0.f; // Depth key (screen Y of where it touches the floor).
+        Submit submit;     // Draws the item.
+    };
+
+    std::vector<Item> items; // Items of the current frame (capacity kept between frames).
+};
@@ -0,0 +1,130 @@
+#include "Renderer.h"
+#include "InputThread.h"
+
+Renderer::Renderer(sf::RenderWindow& window)
+    : window(window) {
+}
+
+Renderer::~Renderer() {
+    stop();
+}
+
+void Renderer::configure(sf::Time budget, float minScale, bool dynamic) {
+    resolution.configure(budget, minScale, dynamic);
+    scale = resolution.getScale();
+}
+
+void Renderer::start() {
+    if (running)
+        return;
+    // A context can only be active on one thread at a time
+    window.setActive(false);
+    stopping = false;
+    running = true;
+    thread = std::thread(&Renderer::threadMain, this);
+}
+
+void Renderer::stop() {
+    if (!running)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    changed.notify_all();
+    thread.join();
+    running = false;
+    pending = -1;
+    window.setActive(true);
+}
+
+DrawList& Renderer::beginFrame() {
+    std::unique_lock<std::mutex> lock(mutex);
+    changed.wait(lock, [this] { return drawing != recording && pending != recording; });
+    DrawList& list = lists[recording];
+    list.reset();
+    return list;
+}
+
+void Renderer::submit(sf::Int64 inputTime) {
+    std::unique_lock<std::mutex> lock(mutex);
+    // Without the thread (not started, or stopped on the way out) the frame is simply dropped
+    if (!running || stopping)
+        return;
+    changed.wait(lock, [this] { return pending == -1; });
+    lists[recording].finish();
+    inputTimes[recording] = inputTime;
+    pending = recording;
+    recording = 1 - recording;
+    lock.unlock();
+    changed.notify_all();
+}
+
+void Renderer::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!running)
+        return;
+    changed.wait(lock, [this] { return pending == -1 && drawing == -1; });
+}
+
+float Renderer::inputLatencyPercentile(float p) const {
+    std::lock_guard<std::mutex> lock(latencyMutex);
+    return latency.percentile(p);
+}
+
+std::size_t Renderer::getInputLatencyCount() const {
+    std::lock_guard<std::mutex> lock(latencyMutex);
+    return latency.size();
+}
+
+void Renderer::threadMain() {
+    window.setActive(true);
+    while (true) {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [this] { return stopping || pending != -1; });
+        if (pending == -1)
+            break; // Stopping, and everything submitted is drawn
+        drawing = pending;
+        pending = -1;
+        lock.unlock();
+        changed.notify_all();
+
+        drawFrame(lists[drawing]);
+        if (inputTimes[drawing] >= 0) {
+            std::lock_guard<std::mutex> latencyLock(latencyMutex);
+            latency.add(static_cast<float>(InputThread::now() - inputTimes[drawing]) / 1000.f);
+        }
+
+        lock.lock();
+        drawing = -1;
+        lock.unlock();
+        changed.notify_all();
+    }
+    window.setActive(false);
+}
+
+void Renderer::drawFrame(const DrawList& list) {
+    sf::Clock renderClock;
+    window.clear();
+    window.setView(resolution.uiView(window.getSize()));
+
+    // World pass: screens with full-screen pictures draw them into the scaled offscreen target
+    const bool world = list.hasLayer(DrawList::Layer::World);
+    if (world) {
+        sf::RenderTarget* target = resolution.begin(window.getSize());
+        list.execute(DrawList::Layer::World, target ? *target : window, caches);
+        if (target)
+            resolution.present(window);
+    }
+
+    // UI pass at native resolution; screens made of text and flat shapes draw everything here
+    list.execute(DrawList::Layer::Ui, window, caches);
+    DrawList::pruneCaches(caches);
+
+    // Measured before display(), which may wait for vsync
+    if (world) {
+        resolution.recordFrame(renderClock.getElapsedTime());
+        scale = resolution.getScale();
+    }
+    window.display();
+}
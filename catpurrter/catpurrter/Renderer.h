@@ -0,0 +1,79 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "DrawList.h"
+#include "ResolutionScaler.h"
+#include "SampleHistory.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// Renderer draws the game's frames on a thread of its own, so the main thread can simulate and
+// record frame N+1 while frame N is being drawn and displayed. The main thread records each frame
+// into one of two DrawLists (beginFrame/submit); the render thread owns the window's GL context,
+// the ResolutionScaler and the baked cacheable parts, and draws whichever list was submitted last.
+// Once started, nothing but the render thread may draw to the window.
+class Renderer {
+public:
+    // Creates a renderer for the window (not started yet).
+    explicit Renderer(sf::RenderWindow& window);
+
+    // Stops the render thread.
+    ~Renderer();
+
+    // Forwards the resolution settings to the ResolutionScaler. Call before start().
+    void configure(sf::Time budget, float minScale, bool dynamic);
+
+    // Hands the window's context over to the render thread and starts it.
+    void start();
+
+    // Draws the frames still submitted, stops the render thread and gives the context back.
+    // Must be called before the window is closed.
+    void stop();
+
+    // Returns the list to record the next frame into, emptied. Waits if the render thread is still drawing it.
+    DrawList& beginFrame();
+
+    // Hands the recorded frame to the render thread. Waits if the one submitted before isn't picked up yet.
+    // inputTime: InputThread::now() stamp of the oldest key press the frame is the first to show (-1 if none);
+    // the time from it to the frame's display() is recorded as input latency.
+    void submit(sf::Int64 inputTime = -1);
+
+    // Waits until every submitted frame has been drawn (nothing is pointing into the views' textures then).
+    void waitIdle();
+
+    // Returns the ResolutionScaler's current scale (as of the last drawn frame).
+    float getScale() const { return scale.load(); }
+
+    // Returns the given percentile (0-100) of the recent input-to-present latencies, in milliseconds.
+    float inputLatencyPercentile(float p) const;
+
+    // Returns how many input latencies are recorded.
+    std::size_t getInputLatencyCount() const;
+
+private:
+    // Render thread body: draws submitted lists until stop().
+    void threadMain();
+
+    // Draws one frame into the window: world layer through the scaler, then the UI layer, then display().
+    void drawFrame(const DrawList& list);
+
+    sf::RenderWindow& window;             // Window drawn into (its context lives on the render thread).
+    ResolutionScaler resolution;          // Scaled world pass (render thread only).
+    DrawList::CacheMap caches;            // Baked cacheable parts (render thread only).
+    DrawList lists[2];                    // Double buffer of recorded frames.
+    sf::Int64 inputTimes[2] = { -1, -1 }; // Input stamp submitted with each list (-1 = none).
+
+    std::mutex mutex;                     // Guards the indices and flags below.
+    std::condition_variable changed;      // Signalled whenever a list changes hands.
+    int recording = 0;                    // List the main thread records into.
+    int pending = -1;                     // List submitted but not picked up yet (-1 = none).
+    int drawing = -1;                     // List the render thread is drawing (-1 = none).
+    bool running = false;                 // The render thread is up.
+    bool stopping = false;                // Set by stop().
+    std::thread thread;                   // Render thread.
+    std::atomic<float> scale{ 1.f };      // Copy of the scaler's scale for the main thread (F3).
+
+    mutable std::mutex latencyMutex;      // Guards latency (written by the render thread, read for F3).
+    SampleHistory latency{ 300 };         // Recent input-to-present latencies in milliseconds.
+};
@@ -0,0 +1,102 @@
+#include "ResolutionScaler.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace {
+    const float SCALE_STEP = 0.1f;        // How much the scale moves per adjustment.
+    const int SETTLE_FRAMES = 30;         // Frames to wait after a change before judging the new scale.
+    const float RAISE_THRESHOLD = 0.7f;   // The scale goes back up once render time is under this share of the budget.
+    const float SMOOTHING = 0.1f;         // Weight of the newest frame in the average.
+}
+
+ResolutionScaler::ResolutionScaler(sf::Vector2f logicalSize)
+    : logicalSize(logicalSize) {
+}
+
+void ResolutionScaler::configure(sf::Time newBudget, float newMinScale, bool isDynamic) {
+    budget = newBudget;
+    minScale = std::clamp(newMinScale, 0.1f, 1.f);
+    dynamic = isDynamic;
+    scale = dynamic ? std::max(scale, minScale) : 1.f;
+}
+
+sf::View ResolutionScaler::uiView(sf::Vector2u windowSize) const {
+    sf::View view(sf::FloatRect(0.f, 0.f, logicalSize.x, logicalSize.y));
+    if (windowSize.x == 0 || windowSize.y == 0)
+        return view;
+
+    // Fit the logical area into the window, centred, with bars on the longer side
+    const float windowRatio = static_cast<float>(windowSize.x) / static_cast<float>(windowSize.y);
+    const float logicalRatio = logicalSize.x / logicalSize.y;
+    if (windowRatio > logicalRatio) {
+        float width = logicalRatio / windowRatio;
+        view.setViewport(sf::FloatRect((1.f - width) / 2.f, 0.f, width, 1.f));
+    }
+    else {
+        float height = windowRatio / logicalRatio;
+        view.setViewport(sf::FloatRect(0.f, (1.f - height) / 2.f, 1.f, height));
+    }
+    return view;
+}
+
+sf::RenderTarget* ResolutionScaler::begin(sf::Vector2u windowSize) {
+    if (failed)
+        return nullptr;
+
+    const sf::FloatRect viewport = uiView(windowSize).getViewport();
+    const sf::Vector2u pixels(static_cast<unsigned>(std::lround(viewport.width * windowSize.x)),
+                              static_cast<unsigned>(std::lround(viewport.height * windowSize.y)));
+    if (pixels.x == 0 || pixels.y == 0)
+        return nullptr;
+
+    // The texture is sized for full scale; lower scales only use its top-left corner, so scale changes don't reallocate
+    if (pixels != targetPixels) {
+        if (!target.create(pixels.x, pixels.y)) {
+            std::cout << "Couldn't create the offscreen world target, drawing at full resolution\n";
+            failed = true;
+            return nullptr;
+        }
+        target.setSmooth(true);
+        targetPixels = pixels;
+    }
+
+    sf::View view(sf::FloatRect(0.f, 0.f, logicalSize.x, logicalSize.y));
+    view.setViewport(sf::FloatRect(0.f, 0.f, scale, scale));
+    target.setView(view);
+    target.clear();
+    return &target;
+}
+
+void ResolutionScaler::present(sf::RenderWindow& window) {
+    target.display();
+
+    const sf::IntRect used(0, 0, static_cast<int>(std::lround(targetPixels.x * scale)),
+                                 static_cast<int>(std::lround(targetPixels.y * scale)));
+    if (used.width <= 0 || used.height <= 0)
+        return;
+    sf::Sprite world(target.getTexture(), used);
+    world.setScale(logicalSize.x / used.width, logicalSize.y / used.height);
+
+    window.setView(uiView(window.getSize()));
+    window.draw(world);
+}
+
+void ResolutionScaler::recordFrame(sf::Time renderTime) {
+    const float ms = renderTime.asSeconds() * 1000.f;
+    averageMs = framesSinceChange == 0 ? ms : averageMs + (ms - averageMs) * SMOOTHING;
+    if (!dynamic || ++framesSinceChange < SETTLE_FRAMES)
+        return;
+
+    const float budgetMs = budget.asSeconds() * 1000.f;
+    float next = scale;
+    if (averageMs > budgetMs)
+        next = std::max(minScale, scale - SCALE_STEP);
+    else if (averageMs < budgetMs * RAISE_THRESHOLD)
+        next = std::min(1.f, scale + SCALE_STEP);
+
+    if (next != scale) {
+        scale = next;
+        framesSinceChange = 0;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+// ResolutionScaler renders the game world into an offscreen texture and shows it letterboxed in the window.
+// The game always draws in logical coordinates (800x600); the window can be any size and keeps the aspect
+// ratio with bars on the sides. The world is drawn at a fraction of the letterbox area's pixels (the scale,
+// e.g. 50-100%), lowered when rendering takes longer than the budget and raised again when there's headroom,
+// so machines with slow fill rate keep their frame rate. Text goes on top at native resolution (see uiView).
+class ResolutionScaler {
+public:
+    // Creates a scaler for the given logical size.
+    explicit ResolutionScaler(sf::Vector2f logicalSize = { 800.f, 600.f });
+
+    // Sets the render time to stay under, the lowest scale allowed, and whether the scale adapts at all.
+    void configure(sf::Time budget, float minScale, bool dynamic);
+
+    // Returns the window view for drawing in logical coordinates inside the letterbox.
+    sf::View uiView(sf::Vector2u windowSize) const;
+
+    // Returns the cleared offscreen target to draw the world into (logical coordinates, current scale),
+    // or nullptr if it can't be used this frame (minimized window, render texture failure); draw to the window then.
+    sf::RenderTarget* begin(sf::Vector2u windowSize);
+
+    // Draws what was rendered since begin() into the window's letterbox, scaled up to fill it.
+    void present(sf::RenderWindow& window);
+
+    // Feeds one frame's render time; every so often the scale steps down (over budget) or up (well under it).
+    void recordFrame(sf::Time renderTime);
+
+    // Returns the current scale (1 = full resolution).
+    float getScale() const { return scale; }
+
+private:
+    sf::Vector2f logicalSize;           // Size of the coordinate space the game draws in.
+    sf::RenderTexture target;           // Offscreen world, sized to the letterbox area at full scale.
+    sf::Vector2u targetPixels;          // Letterbox area in window pixels (the target's size).
+    bool failed = false;                // The render texture couldn't be created; everything draws to the window.
+
+    float scale = 1.f;                  // Fraction of targetPixels the world is drawn at.
+    float minScale = 0.5f;              // Lowest scale allowed.
+    bool dynamic = true;                // False keeps the scale at 1.
+    sf::Time budget = sf::milliseconds(12); // Render time to stay under.
+
+    float averageMs = 0.f;              // Smoothed render time (milliseconds).
+    int framesSinceChange = 0;          // Frames since the scale last changed (changes wait for the average to settle).
+};
@@ -1,4 +1,7 @@
 #include "Room.h"
+#include "Aquarium.h"
+#include "AssetCache.h"
+#include "Interpolation.h"
 
 #include <iostream>
 #include <cmath>
@@ -6,82 +9,156 @@
 #include <random>
 
 
-// Room aquarium area for fish movement (ADJUST HERE)
-const float ROOM_AQUARIUM_LEFT = 590.f;
-const float ROOM_AQUARIUM_TOP = 440.f;
-const float ROOM_AQUARIUM_RIGHT = 730.f;
-const float ROOM_AQUARIUM_BOTTOM = 495.f;
-
-// Fish image size (adjust if needed, or get from texture if you want)
-const float FISH_ROOM_WIDTH = 33.f;
-const float FISH_ROOM_HEIGHT = 21.f;
-
-
 Room::Room(sf::Font& font, Player& player)
     : font(font), playerData(player) {
-    init();
-}
-
-std::string Room::getNearbyObject() const {
-    if (highlightedIndex != -1)
-        return objects[static_cast<size_t>(highlightedIndex)].name;
-    return "";
 }
 
 const Room::RoomObject* Room::getHighlightedObject() const {
-    if (highlightedIndex >= 0 && highlightedIndex < static_cast<int>(objects.size()))
-        return &objects[highlightedIndex];
+    const int highlighted = sim.getHighlighted();
+    if (highlighted >= 0 && highlighted < static_cast<int>(objects.size()))
+        return &objects[highlighted];
     return nullptr;
 }
 
 
-void Room::init() {
-    // --- Load room background texture ---
-    if (!backgroundTexture.loadFromFile("assets/graphics/room.png")) {
-        std::cout << "Failed to load room background image!\n";
+namespace {
+    // Points a sprite at an atlas region (page texture + sub-rect), mirrored horizontally if asked.
+    void setAtlasSprite(sf::Sprite& sprite, const AtlasSprite& atlasSprite, bool mirrored = false) {
+        sprite.setTexture(*atlasSprite.texture);
+        sprite.setTextureRect(atlasSprite.textureRect(mirrored));
     }
-    backgroundSprite.setTexture(backgroundTexture);
 
-    if (!indicatorTexture.loadFromFile("assets/graphics/indicator.png")) {
-        std::cout << "Failed to load indicator icon!\n";
+    // Returns the frame name part of a facing ("down", "up", ...).
+    std::string facingName(RoomSim::Facing facing) {
+        switch (facing) {
+        case RoomSim::Facing::Up:    return "up";
+        case RoomSim::Facing::Left:  return "left";
+        case RoomSim::Facing::Right: return "right";
+        default:                     return "down";
+        }
     }
-    indicatorSprite.setTexture(indicatorTexture);
+}
 
 
-    // --- Player starting position ---
-    playerPos = { 100, 300 };
-    playerRect.setSize({ 40, 60 });
-    playerRect.setFillColor(sf::Color::Green);
-    playerRect.setPosition(playerPos);
+void Room::updatePlayerFrame() {
+    // Facing left uses the right-facing frames mirrored
+    const std::string playerDir = facingName(sim.getFacing());
+    playerMirrored = (playerDir == "left");
+    const std::string frame = (playerMirrored ? "right" : playerDir) + std::to_string(sim.getFrame());
+    hatLayerVisible = false;
+
+    // A hat frame is a small layer over one of the plain frames (whichever pose it was drawn on)
+    auto hat = playerTextures.find(playerData.equippedHat + "_" + frame);
+    if (hat != playerTextures.end() && hat->second.base.empty()) {
+        // Atlas couldn't layer it: it's a full frame
+        setAtlasSprite(playerSprite, hat->second, playerMirrored);
+        return;
+    }
+
+    auto base = playerTextures.find(hat != playerTextures.end() ? hat->second.base : "default_" + frame);
+    if (base != playerTextures.end())
+        setAtlasSprite(playerSprite, base->second, playerMirrored);
+    if (hat != playerTextures.end() && base != playerTextures.end()) {
+        const AtlasSprite& layer = hat->second;
+        setAtlasSprite(hatLayerSprite, layer, playerMirrored);
+        // Mirroring the frame moves the layer to the other side of it
+        float x = playerMirrored ? static_cast<float>(base->second.rect.width - layer.offset.x - layer.rect.width)
+                                 : static_cast<float>(layer.offset.x);
+        hatLayerOffset = { x, static_cast<float>(layer.offset.y) };
+        hatLayerVisible = true;
+    }
+}
+
+void Room::drawPlayer() {
+    batch.add(playerSprite);
+    if (hatLayerVisible) {
+        hatLayerSprite.setPosition(playerSprite.getPosition() + hatLayerOffset);
+        batch.add(hatLayerSprite);
+    }
+}
 
-    // --- Load player textures (default) ---
+void Room::drawStandingObject(size_t index) {
+    const RoomObject& obj = objects[index];
+    switch (index) {
+    case RoomSim::AQUARIUM: {
+        // The tank sprite (with its decorations) stands in for the object's rectangle
+        aquariumTank.setPosition(obj.rect.getPosition());
+        aquariumTank.appendTo(batch);
+        for (const auto& fish : sim.getFish()) {
+            auto it = fishTextures.find(fish.id);
+            if (it != fishTextures.end()) {
+                sf::Sprite fishSprite;
+                setAtlasSprite(fishSprite, it->second, !fish.facingRight);
+                fishSprite.setOrigin(it->second.rect.width / 2.f, it->second.rect.height / 2.f);
+                fishSprite.setPosition(lerp(fish.previous, fish.position, renderAlpha));
+                batch.add(fishSprite);
+            }
+        }
+        break;
+    }
+    case RoomSim::STORAGE_RACK: {
+        // Hats that aren't being worn hang on the rack
+        static const std::vector<sf::Vector2f> rackPositions = {
+            {45.f,  420.f},
+            {105.f, 420.f},
+            {45.f,  480.f},
+            {105.f, 480.f}
+        };
+        batch.add(obj.rect);
+        for (size_t i = 0; i < rackPositions.size(); ++i) {
+            if (i >= playerData.unlockedHats.size()) break;
+            const auto& hatId = playerData.unlockedHats[i];
+            if (hatId == playerData.equippedHat) continue;
+            auto it = hatTextures.find(hatId);
+            if (it != hatTextures.end()) {
+                sf::Sprite hatSprite;
+                setAtlasSprite(hatSprite, it->second);
+                hatSprite.setPosition(rackPositions[i]);
+                batch.add(hatSprite);
+            }
+        }
+        break;
+    }
+    default:
+        batch.add(obj.rect);
+        break;
+    }
+}
+
+AssetList Room::requiredAssets(const Player&) {
+    return { { "assets/graphics/room.png" }, { "room" } };
+}
+
+void Room::init() {
+    AssetCache& assets = AssetCache::instance();
+    // Everything but the background comes from one atlas, so the room draws from a page or two
+    atlas = assets.getAtlas("room");
+    if (!atlas)
+        atlas = std::make_shared<SpriteAtlas>();
+
+    // --- Load room background texture ---
+    backgroundTexture = assets.getTexture("assets/graphics/room.png");
+    if (backgroundTexture)
+        backgroundSprite.setTexture(*backgroundTexture);
+
+    atlas->apply(indicatorSprite, "indicator");
+
+
+    // --- Load player frames (plain cat) and hat layers ---
     playerTextures.clear();
     std::vector<std::string> hats = { "default", "frog", "crown", "pirate", "wizard" };
     for (const std::string& hat : hats) {
-        for (const std::string& dir : { "down", "up", "left", "right" }) {
+        for (const std::string& dir : { "down", "up", "right" }) {
             for (int f = 1; f <= 2; ++f) {
                 std::string key = hat + "_" + dir + std::to_string(f); // eg: frog_left2
-                std::string path = "assets/graphics/player/" + hat + "/" + dir + std::to_string(f) + ".png";
-                auto tex = std::make_shared<sf::Texture>();
-                if (tex->loadFromFile(path)) {
-                    playerTextures[key] = tex;
-                }
-                else {
-                    if (hat == "default")
-                        std::cout << "Missing player texture: " << path << std::endl;
+                if (const AtlasSprite* frame = atlas->find(key)) {
+                    playerTextures[key] = *frame;
                 }
             }
         }
     }
 
 
-    // Set up playerSprite to start with
-    playerDir = "down";
-    playerFrame = 1;
-    animTimer = 0.f;
-    playerSprite.setTexture(*playerTextures["default_down1"]);
-    playerSprite.setPosition(playerPos);
-
     // --- Define and create room objects ---
     objects.clear();
     objects.push_back(createComputer());
@@ -90,272 +167,92 @@ void Room::init() {
     objects.push_back(createShelves());
     objects.push_back(createDoors());
 
+    std::vector<sf::FloatRect> objectBounds;
+    for (const auto& obj : objects)
+        objectBounds.push_back(obj.rect.getGlobalBounds());
+    sim.setObjects(objectBounds);
+
     // --- Load Decoration Textures (shelves) ---
     decorationTextures.clear();
     std::vector<std::string> decoIds = { "car", "books", "plant", "picture" };
     for (const auto& id : decoIds) {
-        sf::Texture tex;
-        std::string path = "assets/graphics/shelves/" + id + "small.png";
-        if (tex.loadFromFile(path)) {
-            decorationTextures[id] = std::move(tex);
-        }
-        else {
-            std::cout << "Failed to load shelf decoration: " << path << "\n";
-        }
+        if (const AtlasSprite* sprite = atlas->find(id + "small"))
+            decorationTextures[id] = *sprite;
     }
 
     // --- Load Hat Textures (storage rack) ---
     hatTextures.clear();
     std::vector<std::string> hatIds = { "crown", "pirate", "frog", "wizard" };
     for (const auto& id : hatIds) {
-        sf::Texture tex;
-        std::string path = "assets/graphics/storagerack/" + id + "small.png";
-        if (tex.loadFromFile(path)) {
-            hatTextures[id] = std::move(tex);
-        }
+        if (const AtlasSprite* sprite = atlas->find(id + "small"))
+            hatTextures[id] = *sprite;
     }
 
-    // --- Load Aquarium small backgrounds (plant, castle, both, none) ---
-    aquariumSmTexture.loadFromFile("assets/graphics/aquarium/aquarium.png");
-    aquariumSmPlants.loadFromFile("assets/graphics/aquarium/aquariumplantssmall.png");
-    aquariumSmCastle.loadFromFile("assets/graphics/aquarium/aquariumcastlesmall.png");
-    aquariumSmAll.loadFromFile("assets/graphics/aquarium/aquariumallsmall.png");
+    // --- Small aquarium: base tank plus a layer per owned decoration ---
+    buildAquariumTank();
 
     // --- Load fish textures ---
     fishTextures.clear();
     std::vector<std::string> fishIds = { "fish1", "fish2", "fish3" };
     for (const auto& id : fishIds) {
-        sf::Texture texRight, texLeft;
-        if (texRight.loadFromFile("assets/graphics/aquarium/" + id + "rightsmall.png"))
-            fishTextures[id + "rightsmall"] = std::move(texRight);
-        if (texLeft.loadFromFile("assets/graphics/aquarium/" + id + "leftsmall.png"))
-            fishTextures[id + "leftsmall"] = std::move(texLeft);
+        if (const AtlasSprite* sprite = atlas->find(id + "small"))
+            fishTextures[id] = *sprite;
     }
 
-    // --- Setup fish visuals based on bought fish ---
-    fishes.clear();
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    // Spawn range: always inside area, never touching the border!
-    std::uniform_real_distribution<float> xDist(
-        ROOM_AQUARIUM_LEFT + FISH_ROOM_WIDTH / 2,
-        ROOM_AQUARIUM_RIGHT - FISH_ROOM_WIDTH / 2
-    );
-    std::uniform_real_distribution<float> yDist(
-        ROOM_AQUARIUM_TOP + FISH_ROOM_HEIGHT / 2,
-        ROOM_AQUARIUM_BOTTOM - FISH_ROOM_HEIGHT / 2
-    );
-    // Make the fish swim *slow* (tweak these as you want)
-    std::uniform_real_distribution<float> vxDist(0.2f, 0.8f);
-
-
-    for (const auto& id : fishIds) {
-        if (std::find(playerData.aquariumContents.begin(), playerData.aquariumContents.end(), id) != playerData.aquariumContents.end()) {
-            FishVisual fish;
-            fish.id = id;
-            fish.facingRight = (gen() % 2 == 0);
-            fish.position = sf::Vector2f(xDist(gen), yDist(gen));
-            float vx = vxDist(gen) * (fish.facingRight ? 1.f : -1.f);
-            fish.velocity = { vx, 0.f };
-            fish.minSwimDistance = 25.f + (gen() % 20);     // lower for smaller aquarium!
-            fish.directionTimer = 0.7f + float(gen() % 200) / 100.0f;
-            fishes.push_back(fish);
-        }
-    }
+    // --- Player at the door, fish based on bought fish ---
+    sim.setFish(ownedFish());
+    sim.reset(std::random_device{}());
+    updatePlayerFrame();
+    sim.setPlayerSize({ playerSprite.getLocalBounds().width, playerSprite.getLocalBounds().height });
+    playerSprite.setPosition(sim.getPlayer());
+}
 
+std::vector<RoomSim::FishKind> Room::ownedFish() const {
+    std::vector<RoomSim::FishKind> kinds;
+    for (const std::string id : { "fish1", "fish2", "fish3" }) {
+        if (std::find(playerData.aquariumContents.begin(), playerData.aquariumContents.end(), id) == playerData.aquariumContents.end())
+            continue;
+        // Actual sprite size keeps the fish inside the glass
+        sf::Vector2f size(33.f, 21.f); // fallback
+        auto it = fishTextures.find(id);
+        if (it != fishTextures.end())
+            size = { static_cast<float>(it->second.rect.width), static_cast<float>(it->second.rect.height) };
+        kinds.push_back({ id, size });
+    }
+    return kinds;
 }
 
 void Room::refreshAquariumVisuals() {
-    // --- Setup fish visuals based on bought fish ---
-    fishes.clear();
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::vector<std::string> fishIds = { "fish1", "fish2", "fish3" };
-    std::uniform_real_distribution<float> xDist(
-        ROOM_AQUARIUM_LEFT + FISH_ROOM_WIDTH / 2,
-        ROOM_AQUARIUM_RIGHT - FISH_ROOM_WIDTH / 2
-    );
-    std::uniform_real_distribution<float> yDist(
-        ROOM_AQUARIUM_TOP + FISH_ROOM_HEIGHT / 2,
-        ROOM_AQUARIUM_BOTTOM - FISH_ROOM_HEIGHT / 2
-    );
-    std::uniform_real_distribution<float> vxDist(0.2f, 0.8f);
-
-    for (const auto& id : fishIds) {
-        if (std::find(playerData.aquariumContents.begin(), playerData.aquariumContents.end(), id) != playerData.aquariumContents.end()) {
-            FishVisual fish;
-            fish.id = id;
-            fish.facingRight = (gen() % 2 == 0);
-            fish.position = sf::Vector2f(xDist(gen), yDist(gen));
-            float vx = vxDist(gen) * (fish.facingRight ? 1.f : -1.f);
-            fish.velocity = { vx, 0.f };
-            fish.minSwimDistance = 25.f + (gen() % 20);
-            fish.directionTimer = 0.7f + float(gen() % 200) / 100.0f;
-            fishes.push_back(fish);
-        }
-    }
+    sim.setFish(ownedFish());
 }
 
 
-void Room::handleInput(sf::Keyboard::Key key) {
-    int dx = 0, dy = 0;
-    if (key == sf::Keyboard::A || key == sf::Keyboard::Left) dx = -1;
-    if (key == sf::Keyboard::D || key == sf::Keyboard::Right) dx = 1;
-    if (key == sf::Keyboard::W || key == sf::Keyboard::Up) dy = -1;
-    if (key == sf::Keyboard::S || key == sf::Keyboard::Down) dy = 1;
-
-    // Only call movePlayer, don't touch playerPos here!
-    movePlayer(dx, dy);
+void Room::buildAquariumTank() {
+    std::vector<std::string> layers;
+    for (const auto& id : Aquarium::ownedDecorations(playerData))
+        layers.push_back("aquarium_" + id);
+    aquariumTank.build(*atlas, "aquarium", layers);
+    aquariumTankVersion = playerData.inventoryVersion;
 }
 
+void Room::update(float dt, const InputState& input) {
+    // Something was bought since the tank was built
+    if (aquariumTankVersion != playerData.inventoryVersion)
+        buildAquariumTank();
 
-void Room::update() {
-    highlightedIndex = -1;
-    float interactRange = 40.f;
-    sf::Vector2f playerFeet = playerRect.getPosition();
-    playerFeet.x += playerRect.getSize().x / 2;
-    playerFeet.y += playerRect.getSize().y;
-
-    for (size_t i = 0; i < objects.size(); ++i) {
-        sf::FloatRect objBounds = objects[i].rect.getGlobalBounds();
-        float dx = std::max(objBounds.left - playerFeet.x, std::max(0.f, playerFeet.x - (objBounds.left + objBounds.width)));
-        float dy = std::max(objBounds.top - playerFeet.y, std::max(0.f, playerFeet.y - (objBounds.top + objBounds.height)));
-        float dist = std::sqrt(dx * dx + dy * dy);
-
-        if (dist < interactRange) {
-            highlightedIndex = static_cast<int>(i);
-            break;
-        }
-    }
-
-    // --- Animate Player Sprite ---
-    float moveX = 0, moveY = 0;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::A) || sf::Keyboard::isKeyPressed(sf::Keyboard::Left))  moveX = -1;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::D) || sf::Keyboard::isKeyPressed(sf::Keyboard::Right)) moveX = 1;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::W) || sf::Keyboard::isKeyPressed(sf::Keyboard::Up))    moveY = -1;
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::S) || sf::Keyboard::isKeyPressed(sf::Keyboard::Down))  moveY = 1;
-
-    // Only update dir if actually moving
-    if (moveX != 0 || moveY != 0) {
-        if (std::abs(moveX) > std::abs(moveY)) playerDir = (moveX > 0) ? "right" : "left";
-        else playerDir = (moveY > 0) ? "down" : "up";
-        // Animation frame switching
-        animTimer += 0.016f; // assuming 60 FPS, otherwise pass dt!
-        if (animTimer >= animDelay) {
-            playerFrame = (playerFrame == 1) ? 2 : 1;
-            animTimer = 0.f;
-        }
-    }
-    else {
-        playerFrame = 1; // Idle, always show frame 1
-    }
-    std::string hatKey = playerData.equippedHat.empty() ? "default" : playerData.equippedHat;
-    std::string key = hatKey + "_" + playerDir + std::to_string(playerFrame);
-    auto it = playerTextures.find(key);
-    // If missing, fall back to default
-    if (it != playerTextures.end()) {
-        playerSprite.setTexture(*it->second);
-    }
-    else {
-        std::string fallbackKey = "default_" + playerDir + std::to_string(playerFrame);
-        auto fallbackIt = playerTextures.find(fallbackKey);
-        if (fallbackIt != playerTextures.end()) {
-            playerSprite.setTexture(*fallbackIt->second);
-        }
-    }
-
-
-
-    playerSprite.setPosition(playerPos);
-
-
-    for (auto& fish : fishes) {
-        // --- Get actual texture size ---
-        std::string texKey = fish.id + (fish.facingRight ? "rightsmall" : "leftsmall");
-        float fishWidth = 33.f, fishHeight = 21.f; // fallback
-        auto it = fishTextures.find(texKey);
-        if (it != fishTextures.end()) {
-            fishWidth = static_cast<float>(it->second.getSize().x);
-            fishHeight = static_cast<float>(it->second.getSize().y);
-        }
-
-        // --- Move fish ---
-        fish.position += fish.velocity * 0.016f;
-        fish.distanceSinceDirectionChange += std::abs(fish.velocity.x * 0.016f) + std::abs(fish.velocity.y * 0.016f);
-
-        // --- Clamp position so center always stays inside ---
-        bool clampedX = false, clampedY = false;
-        if (fish.position.x < ROOM_AQUARIUM_LEFT + fishWidth / 2) {
-            fish.position.x = ROOM_AQUARIUM_LEFT + fishWidth / 2;
-            clampedX = true;
-        }
-        if (fish.position.x > ROOM_AQUARIUM_RIGHT - fishWidth / 2) {
-            fish.position.x = ROOM_AQUARIUM_RIGHT - fishWidth / 2;
-            clampedX = true;
-        }
-        if (fish.position.y < ROOM_AQUARIUM_TOP + fishHeight / 2) {
-            fish.position.y = ROOM_AQUARIUM_TOP + fishHeight / 2;
-            clampedY = true;
-        }
-        if (fish.position.y > ROOM_AQUARIUM_BOTTOM - fishHeight / 2) {
-            fish.position.y = ROOM_AQUARIUM_BOTTOM - fishHeight / 2;
-            clampedY = true;
-        }
-
-        // If clamped X, reverse X direction and reset distance
-        if (clampedX) {
-            fish.velocity.x *= -1.f;
-            fish.facingRight = (fish.velocity.x > 0);
-            fish.distanceSinceDirectionChange = 0.f;
-        }
-        // If clamped Y, stop Y movement and reset timer
-        if (clampedY) {
-            fish.velocity.y = 0.f; // stop vertical movement!
-            fish.verticalSwimTimer = 0.f;
-            fish.distanceSinceDirectionChange = 0.f;
-        }
-
-        // --- Direction change logic ---
-        fish.directionTimer -= 0.016f;
-        bool canChangeDir = (fish.distanceSinceDirectionChange > fish.minSwimDistance);
-
-        // Only allow new Y direction if fish is not already swimming vertically
-        if (canChangeDir && fish.directionTimer < 0) {
-            // 10% chance to flip horizontal
-            if ((rand() % 10) == 0) {
-                fish.velocity.x *= -1.f;
-                fish.facingRight = (fish.velocity.x > 0);
-                fish.distanceSinceDirectionChange = 0.f;
-            }
-            // 35% chance to nudge vertical ONLY if not already moving vertically
-            if (fish.velocity.y == 0.f && (rand() % 3) == 0) {
-                float speedY = 0.02f + float(rand() % 5) * 0.02f; // 26 px/sec, SLOW for small aquarium
-                fish.velocity.y = (rand() % 2 ? 1.f : -1.f) * speedY;
-                fish.verticalSwimTimer = 0.9f + float(rand() % 40) / 100.f; // 0.61.0 sec up/down
-                fish.distanceSinceDirectionChange = 0.f;
-            }
-            fish.directionTimer = 0.45f + float(rand() % 130) / 100.0f;
-        }
-
-        // --- End vertical movement after timer ---
-        if (fish.verticalSwimTimer > 0.f) {
-            fish.verticalSwimTimer -= 0.016f;
-            if (fish.verticalSwimTimer <= 0.f) {
-                fish.velocity.y = 0.f;
-            }
-        }
-    }
+    sim.step(dt, input);
+    updatePlayerFrame();
+    playerSprite.setPosition(sim.getPlayer());
 }
 
+void Room::renderStaticLayer() {
+    // Wall, background objects and shelf decorations only change when something is bought or placed
+    batch.add(backgroundSprite);
 
-
-void Room::render(sf::RenderWindow& window) {
-    window.draw(backgroundSprite);
-
-    // 1. Draw all room objects except aquarium and storage rack
-    for (size_t i = 0; i < objects.size(); ++i) {
-        if (i == Room::STORAGE_RACK || i == Room::AQUARIUM) continue;
-        window.draw(objects[i].rect);
+    // 1. Draw the objects on the wall; the ones standing on the floor are depth-sorted in render()
+    for (const auto& obj : objects) {
+        if (obj.standing) continue;
+        batch.add(obj.rect);
     }
 
     // 2. Draw shelf decorations
@@ -369,337 +266,82 @@ void Room::render(sf::RenderWindow& window) {
         auto it = decorationTextures.find(decoId);
         if (it != decorationTextures.end()) {
             sf::Sprite decoSprite;
-            decoSprite.setTexture(it->second);
+            setAtlasSprite(decoSprite, it->second);
             decoSprite.setPosition(shelfPositions[decoIdx]);
-            window.draw(decoSprite);
+            batch.add(decoSprite);
         }
         decoIdx++;
     }
+}
 
-    // --- Z-ORDER SECTION ---
-
-    // Use the **sprite's** visual feet for correct Z
-    float playerFeetY = playerSprite.getPosition().y + playerSprite.getTexture()->getSize().y;
-
-    // --- AQUARIUM ---
-    const auto& aquariumObj = objects[Room::AQUARIUM];
-    float aquariumCutoffY = aquariumObj.rect.getPosition().y + aquariumObj.rect.getSize().y; // 507
-
-    sf::Sprite aquariumBgSprite;
-    bool hasPlant = false, hasCastle = false;
-    for (const auto& item : playerData.aquariumContents) {
-        if (item == "plant") hasPlant = true;
-        if (item == "castle") hasCastle = true;
-    }
-    if (hasPlant && hasCastle)
-        aquariumBgSprite.setTexture(aquariumSmAll);
-    else if (hasPlant)
-        aquariumBgSprite.setTexture(aquariumSmPlants);
-    else if (hasCastle)
-        aquariumBgSprite.setTexture(aquariumSmCastle);
-    else
-        aquariumBgSprite.setTexture(aquariumSmTexture);
-    aquariumBgSprite.setPosition(aquariumObj.rect.getPosition());
-
-    // --- STORAGE RACK ---
-    const auto& rackObj = objects[Room::STORAGE_RACK];
-    float rackCutoffY = rackObj.rect.getPosition().y + rackObj.rect.getSize().y; // 500
-
-    std::vector<sf::Vector2f> rackPositions = {
-        {45.f,  420.f},
-        {105.f, 420.f},
-        {45.f,  480.f},
-        {105.f, 480.f}
-    };
-
-    // --- DRAW LOGIC ---
-    bool behindAquarium = playerFeetY < aquariumCutoffY;
-    bool behindRack = playerFeetY < rackCutoffY;
-
-    // There are 4 possible cases:
-    if (behindAquarium && behindRack) {
-        // Player is behind both
-        window.draw(playerSprite);
+void Room::render(DrawList& target, float alpha) {
+    // The static part is a cached part of the frame: the render thread bakes it into a texture
+    // and only draws it again when the inventory changes (or the target size does)
+    target.beginCached(this, playerData.inventoryVersion);
+    renderStaticLayer();
+    batch.flush(target);
+    target.endCached();
 
-        window.draw(aquariumBgSprite);
-        for (const auto& fish : fishes) {
-            std::string texKey = fish.id + (fish.facingRight ? "rightsmall" : "leftsmall");
-            auto it = fishTextures.find(texKey);
-            if (it != fishTextures.end()) {
-                sf::Sprite fishSprite;
-                fishSprite.setTexture(it->second);
-                fishSprite.setOrigin(it->second.getSize().x / 2.f, it->second.getSize().y / 2.f);
-                fishSprite.setPosition(fish.position);
-                window.draw(fishSprite);
-            }
-        }
-
-        window.draw(rackObj.rect);
-        for (size_t i = 0; i < rackPositions.size(); ++i) {
-            if (i >= playerData.unlockedHats.size()) break;
-            const auto& hatId = playerData.unlockedHats[i];
-            if (hatId == playerData.equippedHat) continue;
-            auto it = hatTextures.find(hatId);
-            if (it != hatTextures.end()) {
-                sf::Sprite hatSprite;
-                hatSprite.setTexture(it->second);
-                hatSprite.setPosition(rackPositions[i]);
-                window.draw(hatSprite);
-            }
-        }
-    }
-    else if (!behindAquarium && !behindRack) {
-        // Player is in front of both
-        window.draw(aquariumBgSprite);
-        for (const auto& fish : fishes) {
-            std::string texKey = fish.id + (fish.facingRight ? "rightsmall" : "leftsmall");
-            auto it = fishTextures.find(texKey);
-            if (it != fishTextures.end()) {
-                sf::Sprite fishSprite;
-                fishSprite.setTexture(it->second);
-                fishSprite.setOrigin(it->second.getSize().x / 2.f, it->second.getSize().y / 2.f);
-                fishSprite.setPosition(fish.position);
-                window.draw(fishSprite);
-            }
-        }
-        window.draw(rackObj.rect);
-        for (size_t i = 0; i < rackPositions.size(); ++i) {
-            if (i >= playerData.unlockedHats.size()) break;
-            const auto& hatId = playerData.unlockedHats[i];
-            if (hatId == playerData.equippedHat) continue;
-            auto it = hatTextures.find(hatId);
-            if (it != hatTextures.end()) {
-                sf::Sprite hatSprite;
-                hatSprite.setTexture(it->second);
-                hatSprite.setPosition(rackPositions[i]);
-                window.draw(hatSprite);
-            }
-        }
-        window.draw(playerSprite);
-    }
-    else if (behindAquarium && !behindRack) {
-        // Player is between: behind aquarium, in front of rack
-        window.draw(playerSprite);
-
-        window.draw(aquariumBgSprite);
-        for (const auto& fish : fishes) {
-            std::string texKey = fish.id + (fish.facingRight ? "rightsmall" : "leftsmall");
-            auto it = fishTextures.find(texKey);
-            if (it != fishTextures.end()) {
-                sf::Sprite fishSprite;
-                fishSprite.setTexture(it->second);
-                fishSprite.setOrigin(it->second.getSize().x / 2.f, it->second.getSize().y / 2.f);
-                fishSprite.setPosition(fish.position);
-                window.draw(fishSprite);
-            }
-        }
-        window.draw(rackObj.rect);
-        for (size_t i = 0; i < rackPositions.size(); ++i) {
-            if (i >= playerData.unlockedHats.size()) break;
-            const auto& hatId = playerData.unlockedHats[i];
-            if (hatId == playerData.equippedHat) continue;
-            auto it = hatTextures.find(hatId);
-            if (it != hatTextures.end()) {
-                sf::Sprite hatSprite;
-                hatSprite.setTexture(it->second);
-                hatSprite.setPosition(rackPositions[i]);
-                window.draw(hatSprite);
-            }
-        }
-    }
-    else { // (!behindAquarium && behindRack)
-        // Player is between: in front of aquarium, behind rack
-        window.draw(aquariumBgSprite);
-        for (const auto& fish : fishes) {
-            std::string texKey = fish.id + (fish.facingRight ? "rightsmall" : "leftsmall");
-            auto it = fishTextures.find(texKey);
-            if (it != fishTextures.end()) {
-                sf::Sprite fishSprite;
-                fishSprite.setTexture(it->second);
-                fishSprite.setOrigin(it->second.getSize().x / 2.f, it->second.getSize().y / 2.f);
-                fishSprite.setPosition(fish.position);
-                window.draw(fishSprite);
-            }
-        }
-        window.draw(playerSprite);
+    // The player and the fish are drawn between their last two steps
+    renderAlpha = alpha;
+    playerSprite.setPosition(lerp(sim.getPlayerPrevious(), sim.getPlayer(), alpha));
 
-        window.draw(rackObj.rect);
-        for (size_t i = 0; i < rackPositions.size(); ++i) {
-            if (i >= playerData.unlockedHats.size()) break;
-            const auto& hatId = playerData.unlockedHats[i];
-            if (hatId == playerData.equippedHat) continue;
-            auto it = hatTextures.find(hatId);
-            if (it != hatTextures.end()) {
-                sf::Sprite hatSprite;
-                hatSprite.setTexture(it->second);
-                hatSprite.setPosition(rackPositions[i]);
-                window.draw(hatSprite);
-            }
-        }
+    // --- Z-ORDER SECTION ---
+    // Everything on the floor is sorted by where it touches the floor: the player by the
+    // **sprite's** visual feet, furniture by its bottom edge. Furniture goes in first, so the
+    // player standing exactly on an object's edge is drawn in front of it.
+    for (size_t i = 0; i < objects.size(); ++i) {
+        if (!objects[i].standing) continue;
+        const sf::RectangleShape& rect = objects[i].rect;
+        depthQueue.add(rect.getPosition().y + rect.getSize().y, [this, i]() { drawStandingObject(i); });
     }
+    float playerFeetY = playerSprite.getPosition().y + playerSprite.getLocalBounds().height;
+    depthQueue.add(playerFeetY, [this]() { drawPlayer(); });
+    depthQueue.flush();
 
-    // --- Draw interact label and square (unchanged) ---
+    // --- Draw interact square (the label goes on top in renderUi) ---
     if (const RoomObject* obj = getHighlightedObject()) {
-        sf::Text interactText;
-        interactText.setFont(font);
-        interactText.setCharacterSize(32);
-        interactText.setFillColor(sf::Color::Yellow);
-        interactText.setString(">" + obj->name + "<");
-        sf::FloatRect textRect = interactText.getLocalBounds();
-        interactText.setOrigin(textRect.width / 2, 0);
-        interactText.setPosition(window.getSize().x / 2.f, 20.f);
-        window.draw(interactText);
-
         sf::Vector2f objPos = obj->rect.getPosition();
         sf::Vector2f objSize = obj->rect.getSize();
 
        
-        indicatorSprite.setScale(50.f / indicatorTexture.getSize().x, 50.f / indicatorTexture.getSize().y); // scale to 50x50
+        const sf::IntRect indicatorRect = indicatorSprite.getTextureRect();
+        if (indicatorSprite.getTexture() && indicatorRect.width > 0 && indicatorRect.height > 0)
+            indicatorSprite.setScale(50.f / indicatorRect.width, 50.f / indicatorRect.height); // scale to 50x50
         indicatorSprite.setPosition(
             objPos.x + objSize.x / 2.f - 25.f, // center horizontally (50/2 = 25)
             objPos.y - 55.f                    // slightly above, adjust as needed
         );
-        window.draw(indicatorSprite);
+        batch.add(indicatorSprite);
 
 
     }
-}
-
-
-
 
-
-
-
-bool Room::isNearObject() const {
-    sf::FloatRect playerBounds(playerRect.getPosition().x, playerRect.getPosition().y, playerRect.getSize().x, playerRect.getSize().y);
-    const float INTERACT_DISTANCE = 32.f; // or bigger
-
-    for (size_t i = 0; i < objects.size(); ++i) {
-        sf::FloatRect objBounds = objects[i].rect.getGlobalBounds();
-        // Expand object bounds by INTERACT_DISTANCE in all directions
-        objBounds.left -= INTERACT_DISTANCE;
-        objBounds.top -= INTERACT_DISTANCE;
-        objBounds.width += 2 * INTERACT_DISTANCE;
-        objBounds.height += 2 * INTERACT_DISTANCE;
-
-        if (objBounds.intersects(playerBounds)) {
-            // Save i as the highlighted object, etc.
-            return true;
-        }
-    }
-    return false;
+    batch.flush(target);
 }
 
-
-void Room::movePlayer(int dx, int dy) {
-    float playerWidth = playerRect.getSize().x;
-    float playerHeight = playerRect.getSize().y;
-    float minX = 0.f, maxX = 800.f;
-    float minFeetY = 390.f, maxFeetY = 600.f;
-
-    // Adjust collision box for feet area
-    const float playerSpriteWidth = static_cast<float>(playerSprite.getTexture()->getSize().x);
-    const float playerSpriteHeight = static_cast<float>(playerSprite.getTexture()->getSize().y);
-    const float COLLISION_FEET_TOP = 110.f;
-    const float COLLISION_FEET_LEFT = 35.f;
-    const float COLLISION_FEET_WIDTH = 80.f;
-    const float COLLISION_FEET_HEIGHT = 15.f;
-
-
-    // 1. Move X only
-    if (dx != 0) {
-        float newX = playerPos.x + dx * playerSpeed;
-        if (newX < minX) newX = minX;
-        if (newX + playerSpriteWidth > maxX) newX = maxX - playerSpriteWidth;
-
-        sf::FloatRect feetBoxX(
-            newX + COLLISION_FEET_LEFT,
-            playerPos.y + COLLISION_FEET_TOP,
-            COLLISION_FEET_WIDTH,
-            COLLISION_FEET_HEIGHT
-        );
-
-
-        bool blockX = false;
-        {
-            sf::FloatRect computerBounds = objects[Room::COMPUTER].rect.getGlobalBounds();
-            sf::FloatRect rackFull = objects[Room::STORAGE_RACK].rect.getGlobalBounds();
-            sf::FloatRect rackBottom(
-                rackFull.left,
-                rackFull.top + rackFull.height - 40,
-                rackFull.width,
-                40
-            );
-            sf::FloatRect aquariumFull = objects[Room::AQUARIUM].rect.getGlobalBounds();
-            sf::FloatRect aquariumBottom(
-                aquariumFull.left,
-                aquariumFull.top + aquariumFull.height - 40,
-                aquariumFull.width,
-                40
-            );
-            if (computerBounds.intersects(feetBoxX) ||
-                rackBottom.intersects(feetBoxX) ||
-                aquariumBottom.intersects(feetBoxX))
-                blockX = true;
-
-        }
-        if (!blockX) playerPos.x = newX;
+void Room::renderUi(DrawList& window) {
+    if (const RoomObject* obj = getHighlightedObject()) {
+        sf::Text& interactText = texts.get(">" + obj->name + "<", font, 32);
+        interactText.setFillColor(sf::Color::Yellow);
+        sf::FloatRect textRect = interactText.getLocalBounds();
+        interactText.setOrigin(textRect.width / 2, 0);
+        interactText.setPosition(window.getView().getSize().x / 2.f, 20.f);
+        window.draw(interactText);
     }
+}
 
-    // 2. Move Y only
-    if (dy != 0) {
-        float newY = playerPos.y + dy * playerSpeed;
-        if (newY + playerSpriteHeight < minFeetY) newY = minFeetY - playerSpriteHeight;
-        if (newY + playerSpriteHeight > maxFeetY) newY = maxFeetY - playerSpriteHeight;
-
-        sf::FloatRect feetBoxY(
-            playerPos.x + COLLISION_FEET_LEFT,
-            newY + COLLISION_FEET_TOP,
-            COLLISION_FEET_WIDTH,
-            COLLISION_FEET_HEIGHT
-        );
 
 
-        bool blockY = false;
-        {
-            sf::FloatRect computerBounds = objects[Room::COMPUTER].rect.getGlobalBounds();
-            sf::FloatRect rackFull = objects[Room::STORAGE_RACK].rect.getGlobalBounds();
-            sf::FloatRect rackBottom(
-                rackFull.left,
-                rackFull.top + rackFull.height - 40,
-                rackFull.width,
-                40
-            );
-            sf::FloatRect aquariumFull = objects[Room::AQUARIUM].rect.getGlobalBounds();
-            sf::FloatRect aquariumBottom(
-                aquariumFull.left,
-                aquariumFull.top + aquariumFull.height - 40,
-                aquariumFull.width,
-                40
-            );
-            if (computerBounds.intersects(feetBoxY) ||
-                rackBottom.intersects(feetBoxY) ||
-                aquariumBottom.intersects(feetBoxY))
-                blockY = true;
 
-        }
-        if (!blockY) playerPos.y = newY;
-    }
 
-    // Final update
-    playerRect.setPosition(playerPos);
-}
 
 
 Room::RoomObject Room::createComputer() {
     RoomObject obj;
-    obj.texture = std::make_shared<sf::Texture>();
-    if (obj.texture->loadFromFile("assets/graphics/computer.png")) {
-        sf::Vector2u texSize = obj.texture->getSize();
-        obj.rect.setSize(sf::Vector2f(static_cast<float>(texSize.x), static_cast<float>(texSize.y)));
-        obj.rect.setTexture(obj.texture.get());
-        obj.rect.setTextureRect(sf::IntRect(0, 0, texSize.x, texSize.y));
+    if (applyAtlasSprite(obj, "computer")) {
+        sf::IntRect texRect = obj.rect.getTextureRect();
+        obj.rect.setSize(sf::Vector2f(static_cast<float>(texRect.width), static_cast<float>(texRect.height)));
         obj.rect.setPosition(300, 200);       
     }
     else {
@@ -718,15 +360,12 @@ Room::RoomObject Room::createAquarium() {
     obj.rect.setSize({ 200, 157 });
     obj.rect.setPosition(550, 400);
 
-    obj.texture = std::make_shared<sf::Texture>();
-    if (obj.texture->loadFromFile("assets/graphics/aquarium/aquarium.png")) {
-        obj.rect.setTexture(obj.texture.get());
-    }
-    else {
+    if (!applyAtlasSprite(obj, "aquarium")) {
         obj.rect.setFillColor(sf::Color(120, 120, 120));
         std::cout << "Failed to load aquarium texture!\n";
     }
     obj.name = "Aquarium";
+    obj.standing = true;
     return obj;
 }
 
@@ -735,15 +374,12 @@ Room::RoomObject Room::createStorageRack() {
     obj.rect.setSize({ 150, 150 });
     obj.rect.setPosition(30, 400);
 
-    obj.texture = std::make_shared<sf::Texture>();
-    if (obj.texture->loadFromFile("assets/graphics/storagerack/sr.png")) {
-        obj.rect.setTexture(obj.texture.get());
-    }
-    else {
+    if (!applyAtlasSprite(obj, "sr")) {
         obj.rect.setFillColor(sf::Color(120, 120, 120));
         std::cout << "Failed to load storage rack texture!\n";
     }
     obj.name = "Storage Rack";
+    obj.standing = true;
     return obj;
 }
 
@@ -752,11 +388,7 @@ Room::RoomObject Room::createShelves() {
     obj.rect.setSize({ 200, 300 });
     obj.rect.setPosition(550, 70);
 
-    obj.texture = std::make_shared<sf::Texture>();
-    if (obj.texture->loadFromFile("assets/graphics/shelves/shelves.png")) {
-        obj.rect.setTexture(obj.texture.get());
-    }
-    else {
+    if (!applyAtlasSprite(obj, "shelves")) {
         obj.rect.setFillColor(sf::Color(120, 120, 120));
         std::cout << "Failed to load shelves texture!\n";
     }
@@ -769,11 +401,7 @@ Room::RoomObject Room::createDoors() {
     obj.rect.setSize({ 100, 200 });
     obj.rect.setPosition(60, 155);
 
-    obj.texture = std::make_shared<sf::Texture>();
-    if (obj.texture->loadFromFile("assets/graphics/doors.png")) {
-        obj.rect.setTexture(obj.texture.get());
-    }
-    else {
+    if (!applyAtlasSprite(obj, "doors")) {
         obj.rect.setFillColor(sf::Color(120, 120, 120));
         std::cout << "Failed to load doors texture!\n";
     }
@@ -781,3 +409,12 @@ Room::RoomObject Room::createDoors() {
     return obj;
 }
 
+bool Room::applyAtlasSprite(RoomObject& obj, const std::string& id) {
+    const AtlasSprite* sprite = atlas ? atlas->find(id) : nullptr;
+    if (!sprite)
+        return false;
+    obj.texture = sprite->texture;
+    obj.rect.setTexture(obj.texture.get());
+    obj.rect.setTextureRect(sprite->rect);
+    return true;
+}
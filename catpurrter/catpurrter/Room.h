@@ -1,15 +1,25 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "DrawList.h"
 #include <vector>
 #include <string>
 #include <memory>
 #include "Player.h"
+#include "AssetCache.h"
+#include "SpriteAtlas.h"
+#include "LayeredSprite.h"
+#include "SpriteBatch.h"
+#include "RenderQueue.h"
+#include "TextCache.h"
+#include "Scene.h"
+#include "InputState.h"
+#include "RoomSim.h"
 #include <map>
 
 // The Room class represents the main interactive room view where the player moves around.
-// It handles drawing the player, objects (aquarium, computer, shelves, storage rack, doors),
-// collision, interaction highlights, and showing owned decorations and hats.
-class Room {
+// It draws the player, objects (aquarium, computer, shelves, storage rack, doors), interaction highlights,
+// owned decorations and hats; walking, collision and the fish are a RoomSim it steps and draws.
+class Room : public Scene {
 public:
     // Constructs the Room with references to the font and player data.
     Room(sf::Font& font, Player& player);
@@ -18,81 +28,69 @@ public:
     struct RoomObject {
         sf::RectangleShape rect;            // Rectangle area and texture for the object.
         std::string name;                   // Name for display and interaction (e.g., "Aquarium").
-        std::shared_ptr<sf::Texture> texture; // Shared pointer to the object's texture.
+        std::shared_ptr<sf::Texture> texture; // Atlas page the object's sprite lives on.
+        bool standing = false;              // Stands on the floor and is depth-sorted with the player (else hangs on the wall).
     };
 
     // Rebuilds/refreshes the fish visuals in the aquarium (e.g., after buying new fish).
     void refreshAquariumVisuals();
 
-    // Moves the player by (dx, dy), handling collision and updating player position.
-    void movePlayer(int dx, int dy);
-
     // Initializes all room state: loads textures, sets up player and objects, places decorations, etc.
     void init();
 
-    // Handles keyboard input for movement (WASD/arrow keys).
-    void handleInput(sf::Keyboard::Key key);
+    // Returns the textures and atlases init() uses, so they can be prefetched before the room opens.
+    static AssetList requiredAssets(const Player& player);
+
+    // Advances one simulation step of dt seconds: the cat walks with the held direction keys,
+    // the fish swim, and the highlight follows the cat.
+    void update(float dt, const InputState& input);
+
+    // Draws the room, player, objects, decorations, hats, fish, and the interaction marker
+    // (the world pass, may be drawn at reduced resolution).
+    // alpha: how far (0-1) the frame lies between the last two steps; the player and fish are drawn in between.
+    void render(DrawList& target, float alpha);
+
+    // Draws the highlighted object's name on top at native resolution.
+    void renderUi(DrawList& target);
 
-    // Updates all state: player movement, animation, collision detection, fish animation, highlights, etc.
-    void update();
+    // Returns the number of draw calls the last render() made.
+    std::size_t getDrawCalls() const { return batch.getDrawCalls(); }
 
-    // Draws the room, player, objects, decorations, hats, fish, and interaction highlights.
-    void render(sf::RenderWindow& window);
+    // Returns the number of quads the last render() drew.
+    std::size_t getQuadCount() const { return batch.getQuadCount(); }
 
     // Returns true if the player is close enough to any object for interaction.
-    bool isNearObject() const;
+    bool isNearObject() const { return sim.isNearObject(); }
 
-    // Returns the name of the object the player is nearest to, or empty string if none.
-    std::string getNearbyObject() const;
+    // Returns the id (RoomSim::ObjectId) of the object the player is nearest to, or NO_OBJECT if none.
+    int getNearbyObject() const { return sim.getHighlighted(); }
 
     // Returns a pointer to the currently highlighted object (if any).
     const RoomObject* getHighlightedObject() const;
 
-    // Enum for easy access to each room object by index.
-    enum RoomObjectIndex {
-        COMPUTER = 0,
-        AQUARIUM = 1,
-        STORAGE_RACK = 2,
-        SHELVES = 3,
-        DOORS = 4
-    };
+    LayeredSprite aquariumTank;        // Small (room) aquarium with a layer per owned decoration.
+    unsigned aquariumTankVersion = 0;  // Player::inventoryVersion aquariumTank was built for.
 
-    // Aquarium background textures for small (room) aquarium with various decorations:
-    sf::Texture aquariumSmTexture;     // Default aquarium (no decorations)
-    sf::Texture aquariumSmPlants;      // Aquarium with plant decoration
-    sf::Texture aquariumSmCastle;      // Aquarium with castle decoration
-    sf::Texture aquariumSmAll;         // Aquarium with both plant and castle
-
-    // FishVisual represents one fish swimming in the small aquarium in the room.
-    struct FishVisual {
-        std::string id;                      // Fish type (e.g., "fish1")
-        sf::Vector2f position;               // Fish position in the room aquarium area
-        sf::Vector2f velocity;               // Current velocity (pixels/sec)
-        bool facingRight = true;             // True if fish is facing right
-        float directionTimer = 0.f;          // Timer for when fish will change direction again
-        float minSwimDistance = 0.f;         // Minimum distance before changing direction
-        float distanceSinceDirectionChange = 0.f; // How far the fish has swum since last direction change
-        float verticalSwimTimer = 0.f;       // Timer for how long fish swims vertically
-    };
+    // Rebuilds aquariumTank from the decorations the player owns.
+    void buildAquariumTank();
 
-    std::vector<FishVisual> fishes;                      // List of all fish in the room aquarium.
-    std::unordered_map<std::string, sf::Texture> fishTextures; // Fish textures (by id+direction).
+    std::unordered_map<std::string, AtlasSprite> fishTextures; // Right-facing fish sprites in the room atlas (by fish id).
 
 private:
     sf::Font& font;                              // Reference to the game's font.
+    TextCache texts;                             // Interact label for the highlighted object.
     Player& playerData;                          // Reference to player data (decorations, fish, hats).
 
-    sf::RectangleShape playerRect;               // Rectangle for player's collision and position.
-    sf::Vector2f playerPos;                      // Player's current position in the room.
-    float playerSpeed = 0.20f;                   // Player's movement speed.
+    RoomSim sim;                                 // Cat, highlight and fish (objects created in RoomSim::ObjectId order).
+    float renderAlpha = 1.f;                     // Interpolation factor of the frame being drawn.
+
+    std::shared_ptr<SpriteAtlas> atlas;          // Room atlas: player frames, fish, decorations, hats, furniture.
 
-    sf::Texture indicatorTexture;                // Texture for the "interact" indicator icon.
     sf::Sprite indicatorSprite;                  // Sprite for drawing the indicator.
 
     std::vector<RoomObject> objects;             // All interactive objects in the room.
-    int highlightedIndex = -1;                   // Which object (if any) is currently highlighted for interaction.
 
-    sf::Texture backgroundTexture;               // Background room image.
+    std::shared_ptr<sf::Texture> backgroundTexture; // Background room image.
     sf::Sprite backgroundSprite;                 // Sprite for drawing the background.
 
     // Creates a RoomObject for each room feature.
@@ -102,6 +100,27 @@ private:
     RoomObject createShelves();
     RoomObject createDoors();
 
+    // Points the object's rectangle at an atlas sprite. Returns false if the sprite isn't in the atlas.
+    bool applyAtlasSprite(RoomObject& obj, const std::string& id);
+
+    // Returns the fish the player owns, with their sprite sizes, for the sim's aquarium.
+    std::vector<RoomSim::FishKind> ownedFish() const;
+
+    // Picks the cat frame and hat layer for the sim's facing, walk frame and the equipped hat.
+    void updatePlayerFrame();
+
+    // Queues the cat with its hat layer on top.
+    void drawPlayer();
+
+    // Queues a floor-standing object with what's in or on it (aquarium with fish, rack with hats).
+    void drawStandingObject(size_t index);
+
+    // Queues the parts of the room that don't move: background, wall objects and shelf decorations.
+    void renderStaticLayer();
+
+    SpriteBatch batch;                           // Collects the frame's sprites so render() makes a few draw calls.
+    RenderQueue depthQueue;                      // Sorts the floor-standing objects and the player back to front.
+
     // For possible future use: Information about decorations available in the shop.
     struct DecorationInfo {
         std::string id;      // Decoration ID string.
@@ -110,17 +129,16 @@ private:
     };
 
     std::vector<DecorationInfo> decorations;         // All possible decorations.
-    std::map<std::string, sf::Texture> decorationTextures; // Textures for small shelf decorations.
+    std::map<std::string, AtlasSprite> decorationTextures; // Atlas sprites for small shelf decorations.
 
-    std::map<std::string, sf::Texture> hatTextures;        // Small textures for unlocked hats (room rack).
+    std::map<std::string, AtlasSprite> hatTextures;        // Small atlas sprites for unlocked hats (room rack).
 
     std::unordered_map<std::string, sf::Texture> aquariumItemTextures; // Not used directly in render, for future expansion.
 
-    sf::Sprite playerSprite;                        // Sprite for drawing the player with animation/hat.
-    std::map<std::string, std::shared_ptr<sf::Texture>> playerTextures; // Player sprite textures (hat+direction+frame).
-
-    std::string playerDir = "down";                 // Player's current facing direction ("up", "down", etc.).
-    int playerFrame = 1;                            // Animation frame (1 or 2).
-    float animTimer = 0.f;                          // Timer for switching animation frames.
-    float animDelay = 6.f;                          // Number of update cycles between frame switches.
+    sf::Sprite playerSprite;                        // Sprite for drawing the plain cat frame.
+    sf::Sprite hatLayerSprite;                      // Equipped hat layer drawn over playerSprite.
+    bool hatLayerVisible = false;                   // False when no hat is equipped (or its layer is missing).
+    sf::Vector2f hatLayerOffset;                    // Hat layer position relative to playerSprite.
+    bool playerMirrored = false;                    // True while facing left (right-facing frames drawn mirrored).
+    std::map<std::string, AtlasSprite> playerTextures; // Plain cat frames and hat layers in the atlas (hat+direction+frame).
 };
@@ -0,0 +1,265 @@
+#include "RoomSim.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Room aquarium area for fish movement (ADJUST HERE)
+    const float ROOM_AQUARIUM_LEFT = 590.f;
+    const float ROOM_AQUARIUM_TOP = 440.f;
+    const float ROOM_AQUARIUM_RIGHT = 730.f;
+    const float ROOM_AQUARIUM_BOTTOM = 495.f;
+
+    // Fish size the spawn range keeps clear of the glass
+    const float FISH_ROOM_WIDTH = 33.f;
+    const float FISH_ROOM_HEIGHT = 21.f;
+
+    // Where the cat walks: inside the room, feet between the wall and the bottom edge
+    const float MIN_X = 0.f, MAX_X = 800.f;
+    const float MIN_FEET_Y = 390.f, MAX_FEET_Y = 600.f;
+    const float PLAYER_SPEED = 150.f;       // Walking speed (pixels/sec).
+    const float ANIM_DELAY = 0.15f;         // Seconds between walk frame switches.
+
+    // Collision box of the feet, relative to the cat frame
+    const float COLLISION_FEET_TOP = 110.f;
+    const float COLLISION_FEET_LEFT = 35.f;
+    const float COLLISION_FEET_WIDTH = 80.f;
+    const float COLLISION_FEET_HEIGHT = 15.f;
+
+    // Height of the part of the rack and aquarium the cat can't walk through (it passes behind the rest)
+    const float STANDING_DEPTH = 40.f;
+
+    // Interaction box at the cat's position; the highlight is measured from its bottom centre
+    const sf::Vector2f INTERACT_BOX = { 40.f, 60.f };
+    const float INTERACT_RANGE = 40.f;      // Feet distance for the highlight.
+    const float NEAR_DISTANCE = 32.f;       // Box distance for isNearObject().
+
+    // Returns the bottom strip of a standing object.
+    sf::FloatRect bottomOf(const sf::FloatRect& rect) {
+        return { rect.left, rect.top + rect.height - STANDING_DEPTH, rect.width, STANDING_DEPTH };
+    }
+}
+
+RoomSim::RoomSim()
+    : objects(defaultObjects()), playerSize(150.f, 150.f) {
+    reset(0);
+}
+
+std::vector<sf::FloatRect> RoomSim::defaultObjects() {
+    return {
+        { 300.f, 200.f, 200.f, 170.f }, // COMPUTER
+        { 550.f, 400.f, 200.f, 157.f }, // AQUARIUM
+        { 30.f, 400.f, 150.f, 150.f },  // STORAGE_RACK
+        { 550.f, 70.f, 200.f, 300.f },  // SHELVES
+        { 60.f, 155.f, 100.f, 200.f }   // DOORS
+    };
+}
+
+RoomSim::Fish RoomSim::spawnFish(const FishKind& kind) {
+    // Spawn range: always inside area, never touching the border!
+    std::uniform_real_distribution<float> xDist(
+        ROOM_AQUARIUM_LEFT + FISH_ROOM_WIDTH / 2,
+        ROOM_AQUARIUM_RIGHT - FISH_ROOM_WIDTH / 2
+    );
+    std::uniform_real_distribution<float> yDist(
+        ROOM_AQUARIUM_TOP + FISH_ROOM_HEIGHT / 2,
+        ROOM_AQUARIUM_BOTTOM - FISH_ROOM_HEIGHT / 2
+    );
+    // Make the fish swim *slow* (tweak these as you want)
+    std::uniform_real_distribution<float> vxDist(10.f, 40.f);
+
+    Fish one;
+    one.id = kind.id;
+    one.size = kind.size;
+    one.facingRight = (rng() % 2 == 0);
+    one.position = sf::Vector2f(xDist(rng), yDist(rng));
+    one.previous = one.position;
+    float vx = vxDist(rng) * (one.facingRight ? 1.f : -1.f);
+    one.velocity = { vx, 0.f };
+    one.minSwimDistance = 25.f + (rng() % 20);     // lower for smaller aquarium!
+    one.directionTimer = 0.7f + float(rng() % 200) / 100.0f;
+    return one;
+}
+
+void RoomSim::setFish(const std::vector<FishKind>& kinds) {
+    fishKinds = kinds;
+    fish.clear();
+    for (const auto& kind : fishKinds)
+        fish.push_back(spawnFish(kind));
+}
+
+void RoomSim::reset(unsigned seed) {
+    rng.seed(seed);
+    player = { 100.f, 300.f };
+    playerPrevious = player;
+    facing = Facing::Down;
+    frame = 1;
+    animTimer = 0.f;
+    highlighted = NO_OBJECT;
+    visits = 0;
+    setFish(fishKinds);
+}
+
+bool RoomSim::isNearObject() const {
+    sf::FloatRect playerBounds(player, INTERACT_BOX);
+    for (sf::FloatRect objBounds : objects) {
+        // Expand object bounds by NEAR_DISTANCE in all directions
+        objBounds.left -= NEAR_DISTANCE;
+        objBounds.top -= NEAR_DISTANCE;
+        objBounds.width += 2 * NEAR_DISTANCE;
+        objBounds.height += 2 * NEAR_DISTANCE;
+        if (objBounds.intersects(playerBounds))
+            return true;
+    }
+    return false;
+}
+
+void RoomSim::updateHighlight() {
+    const int before = highlighted;
+    highlighted = NO_OBJECT;
+    const sf::Vector2f playerFeet(player.x + INTERACT_BOX.x / 2, player.y + INTERACT_BOX.y);
+
+    for (size_t i = 0; i < objects.size(); ++i) {
+        const sf::FloatRect& objBounds = objects[i];
+        float dx = std::max(objBounds.left - playerFeet.x, std::max(0.f, playerFeet.x - (objBounds.left + objBounds.width)));
+        float dy = std::max(objBounds.top - playerFeet.y, std::max(0.f, playerFeet.y - (objBounds.top + objBounds.height)));
+        if (std::sqrt(dx * dx + dy * dy) < INTERACT_RANGE) {
+            highlighted = static_cast<int>(i);
+            break;
+        }
+    }
+    if (highlighted != NO_OBJECT && highlighted != before)
+        ++visits;
+}
+
+bool RoomSim::blocked(sf::Vector2f position) const {
+    if (objects.size() <= STORAGE_RACK)
+        return false;
+    sf::FloatRect feet(
+        position.x + COLLISION_FEET_LEFT,
+        position.y + COLLISION_FEET_TOP,
+        COLLISION_FEET_WIDTH,
+        COLLISION_FEET_HEIGHT
+    );
+    return objects[COMPUTER].intersects(feet) ||
+        bottomOf(objects[STORAGE_RACK]).intersects(feet) ||
+        bottomOf(objects[AQUARIUM]).intersects(feet);
+}
+
+void RoomSim::walk(int dx, int dy, float dt) {
+    // 1. Move X only
+    if (dx != 0) {
+        float newX = player.x + dx * PLAYER_SPEED * dt;
+        if (newX < MIN_X) newX = MIN_X;
+        if (newX + playerSize.x > MAX_X) newX = MAX_X - playerSize.x;
+        if (!blocked({ newX, player.y })) player.x = newX;
+    }
+
+    // 2. Move Y only
+    if (dy != 0) {
+        float newY = player.y + dy * PLAYER_SPEED * dt;
+        if (newY + playerSize.y < MIN_FEET_Y) newY = MIN_FEET_Y - playerSize.y;
+        if (newY + playerSize.y > MAX_FEET_Y) newY = MAX_FEET_Y - playerSize.y;
+        if (!blocked({ player.x, newY })) player.y = newY;
+    }
+}
+
+void RoomSim::swim(Fish& one, float dt) {
+    // --- Move fish ---
+    one.previous = one.position;
+    one.position += one.velocity * dt;
+    one.distanceSinceDirectionChange += std::abs(one.velocity.x * dt) + std::abs(one.velocity.y * dt);
+
+    // --- Clamp position so center always stays inside ---
+    bool clampedX = false, clampedY = false;
+    if (one.position.x < ROOM_AQUARIUM_LEFT + one.size.x / 2) {
+        one.position.x = ROOM_AQUARIUM_LEFT + one.size.x / 2;
+        clampedX = true;
+    }
+    if (one.position.x > ROOM_AQUARIUM_RIGHT - one.size.x / 2) {
+        one.position.x = ROOM_AQUARIUM_RIGHT - one.size.x / 2;
+        clampedX = true;
+    }
+    if (one.position.y < ROOM_AQUARIUM_TOP + one.size.y / 2) {
+        one.position.y = ROOM_AQUARIUM_TOP + one.size.y / 2;
+        clampedY = true;
+    }
+    if (one.position.y > ROOM_AQUARIUM_BOTTOM - one.size.y / 2) {
+        one.position.y = ROOM_AQUARIUM_BOTTOM - one.size.y / 2;
+        clampedY = true;
+    }
+
+    // If clamped X, reverse X direction and reset distance
+    if (clampedX) {
+        one.velocity.x *= -1.f;
+        one.facingRight = (one.velocity.x > 0);
+        one.distanceSinceDirectionChange = 0.f;
+    }
+    // If clamped Y, stop Y movement and reset timer
+    if (clampedY) {
+        one.velocity.y = 0.f; // stop vertical movement!
+        one.verticalSwimTimer = 0.f;
+        one.distanceSinceDirectionChange = 0.f;
+    }
+
+    // --- Direction change logic ---
+    one.directionTimer -= dt;
+    bool canChangeDir = (one.distanceSinceDirectionChange > one.minSwimDistance);
+
+    // Only allow new Y direction if fish is not already swimming vertically
+    if (canChangeDir && one.directionTimer < 0) {
+        // 10% chance to flip horizontal
+        if ((rng() % 10) == 0) {
+            one.velocity.x *= -1.f;
+            one.facingRight = (one.velocity.x > 0);
+            one.distanceSinceDirectionChange = 0.f;
+        }
+        // 35% chance to nudge vertical ONLY if not already moving vertically
+        if (one.velocity.y == 0.f && (rng() % 3) == 0) {
+            float speedY = 2.f + float(rng() % 5); // 2-6 px/sec, SLOW for small aquarium
+            one.velocity.y = (rng() % 2 ? 1.f : -1.f) * speedY;
+            one.verticalSwimTimer = 0.9f + float(rng() % 40) / 100.f; // 0.9-1.3 sec up/down
+            one.distanceSinceDirectionChange = 0.f;
+        }
+        one.directionTimer = 0.45f + float(rng() % 130) / 100.0f;
+    }
+
+    // --- End vertical movement after timer ---
+    if (one.verticalSwimTimer > 0.f) {
+        one.verticalSwimTimer -= dt;
+        if (one.verticalSwimTimer <= 0.f) {
+            one.velocity.y = 0.f;
+        }
+    }
+}
+
+void RoomSim::step(float dt, const InputState& input) {
+    playerPrevious = player;
+    updateHighlight();
+
+    int dx = 0, dy = 0;
+    if (input.isHeld(Action::MoveLeft))  dx -= 1;
+    if (input.isHeld(Action::MoveRight)) dx += 1;
+    if (input.isHeld(Action::MoveUp))    dy -= 1;
+    if (input.isHeld(Action::MoveDown))  dy += 1;
+
+    // --- Walk animation: face the held direction, idle shows frame 1 ---
+    if (dx != 0 || dy != 0) {
+        // Diagonals face up or down
+        if (dy != 0) facing = (dy > 0) ? Facing::Down : Facing::Up;
+        else facing = (dx > 0) ? Facing::Right : Facing::Left;
+        animTimer += dt;
+        if (animTimer >= ANIM_DELAY) {
+            frame = (frame == 1) ? 2 : 1;
+            animTimer = 0.f;
+        }
+    }
+    else {
+        frame = 1;
+    }
+
+    for (auto& one : fish)
+        swim(one, dt);
+
+    if (dx != 0 || dy != 0)
+        walk(dx, dy, dt);
+}
@@ -0,0 +1,117 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include "Simulation.h"
+#include <random>
+#include <string>
+#include <vector>
+
+// RoomSim is what moves in the room: the cat walking on the floor around the furniture, its walk animation,
+// which object it can interact with, and the fish swimming in the small aquarium.
+// The furniture's rectangles and the cat frame's size come from the Room that draws it (setObjects /
+// setPlayerSize); until then the room's usual layout is used, which is what catpurrter_sim walks in.
+// The room never ends, so the score is just how many times the highlighted object changed.
+class RoomSim : public Simulation {
+public:
+    // Ids of the room objects, which are also their indices in the object list.
+    enum ObjectId {
+        NO_OBJECT = -1,
+        COMPUTER = 0,
+        AQUARIUM = 1,
+        STORAGE_RACK = 2,
+        SHELVES = 3,
+        DOORS = 4
+    };
+
+    // Which way the cat faces.
+    enum class Facing { Down, Up, Left, Right };
+
+    // A kind of fish in the aquarium: its id and the size of its sprite (keeps it inside the glass).
+    struct FishKind {
+        std::string id;    // Fish type (e.g., "fish1").
+        sf::Vector2f size; // Sprite size in the room.
+    };
+
+    // One fish swimming in the small aquarium.
+    struct Fish {
+        std::string id;                      // Fish type (e.g., "fish1")
+        sf::Vector2f size;                   // Sprite size (kept inside the aquarium area)
+        sf::Vector2f position;               // Centre in the room aquarium area
+        sf::Vector2f previous;               // Centre after the previous step
+        sf::Vector2f velocity;               // Current velocity (pixels/sec)
+        bool facingRight = true;             // True if fish is facing right
+        float directionTimer = 0.f;          // Timer for when fish will change direction again
+        float minSwimDistance = 0.f;         // Minimum distance before changing direction
+        float distanceSinceDirectionChange = 0.f; // How far the fish has swum since last direction change
+        float verticalSwimTimer = 0.f;       // Timer for how long fish swims vertically
+    };
+
+    RoomSim();
+
+    // Returns the objects' rectangles as Room lays them out (with the computer's usual sprite size).
+    static std::vector<sf::FloatRect> defaultObjects();
+
+    // Sets the objects' rectangles, indexed by ObjectId.
+    void setObjects(const std::vector<sf::FloatRect>& rects) { objects = rects; }
+
+    // Sets the size of the cat frame (the walk keeps it inside the room and its feet on the floor).
+    void setPlayerSize(sf::Vector2f size) { playerSize = size; }
+
+    // Replaces the fish with one of each kind, placed and headed at random.
+    void setFish(const std::vector<FishKind>& kinds);
+
+    // Puts the cat at the door facing down and places the fish again.
+    void reset(unsigned seed) override;
+
+    // Updates the highlight, the walk animation and the fish, then walks the cat with the held direction keys.
+    void step(float dt, const InputState& input) override;
+
+    // Returns how many times the highlighted object changed (the bot's measure of getting around).
+    int getScore() const override { return visits; }
+
+    // Returns the cat frame's top-left corner now and after the previous step.
+    sf::Vector2f getPlayer() const { return player; }
+    sf::Vector2f getPlayerPrevious() const { return playerPrevious; }
+
+    // Returns the way the cat faces and its walk frame (1 or 2).
+    Facing getFacing() const { return facing; }
+    int getFrame() const { return frame; }
+
+    // Returns the object the cat can interact with (ObjectId), NO_OBJECT if none.
+    int getHighlighted() const { return highlighted; }
+
+    // Returns true if the cat is close enough to any object for interaction.
+    bool isNearObject() const;
+
+    // Returns the fish in the aquarium.
+    const std::vector<Fish>& getFish() const { return fish; }
+
+private:
+    // Walks the cat for dt seconds in direction (dx, dy), one axis at a time so it slides along furniture.
+    void walk(int dx, int dy, float dt);
+
+    // Returns true if the cat's feet, with the frame at position, would overlap furniture.
+    bool blocked(sf::Vector2f position) const;
+
+    // Finds the object near the cat's feet.
+    void updateHighlight();
+
+    // Moves a fish, turning it at the glass and now and then at random.
+    void swim(Fish& one, float dt);
+
+    // Places a fish of the given kind at a random spot, swimming slowly left or right.
+    Fish spawnFish(const FishKind& kind);
+
+    std::mt19937 rng;                       // Fish placement and turns.
+    std::vector<sf::FloatRect> objects;     // Object rectangles (by ObjectId).
+    sf::Vector2f playerSize;                // Cat frame size.
+    sf::Vector2f player;                    // Cat frame's top-left corner.
+    sf::Vector2f playerPrevious;            // Cat position after the previous step.
+    Facing facing = Facing::Down;           // Way the cat faces.
+    int frame = 1;                          // Walk frame (1 or 2).
+    float animTimer = 0.f;                  // Time since the walk frame switched.
+    int highlighted = NO_OBJECT;            // Object the cat can interact with.
+    int visits = 0;                         // Times the highlight changed.
+    std::vector<FishKind> fishKinds;        // Kinds placed on reset.
+    std::vector<Fish> fish;                 // Fish swimming.
+};
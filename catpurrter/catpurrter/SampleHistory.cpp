@@ -0,0 +1,21 @@
+#include "SampleHistory.h"
+#include <algorithm>
+
+SampleHistory::SampleHistory(std::size_t capacity)
+    : samples(std::max<std::size_t>(1, capacity), 0.f) {
+}
+
+void SampleHistory::add(float sample) {
+    samples[next] = sample;
+    next = (next + 1) % samples.size();
+    count = std::min(count + 1, samples.size());
+}
+
+float SampleHistory::percentile(float p) const {
+    if (count == 0)
+        return 0.f;
+    std::vector<float> sorted(samples.begin(), samples.begin() + count);
+    std::size_t rank = static_cast<std::size_t>(std::clamp(p, 0.f, 100.f) / 100.f * static_cast<float>(count - 1) + 0.5f);
+    std::nth_element(sorted.begin(), sorted.begin() + rank, sorted.end());
+    return sorted[rank];
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+// SampleHistory keeps the last few hundred measurements (frame times, latencies) in a ring buffer
+// and answers percentile queries over them. Not synchronized; owners shared between threads lock around it.
+class SampleHistory {
+public:
+    // Creates a history keeping the last `capacity` samples.
+    explicit SampleHistory(std::size_t capacity);
+
+    // Records a sample, replacing the oldest once the buffer is full.
+    void add(float sample);
+
+    // Returns the given percentile (0-100) of the recorded samples (0 if none yet).
+    float percentile(float p) const;
+
+    // Returns how many samples are recorded (at most the capacity).
+    std::size_t size() const { return count; }
+
+private:
+    std::vector<float> samples;  // Ring buffer.
+    std::size_t next = 0;        // Slot the next sample goes into.
+    std::size_t count = 0;       // Valid samples in the buffer.
+};
@@ -0,0 +1,28 @@
+#pragma once
+
+// Scene is the part every screen (room, close-up views, shops, minigames) has in common as far as the
+// SceneStack is concerned: it is told when it comes to the top of the stack and when it leaves it, and
+// it can ask to be closed. A closed scene isn't destroyed; it's suspended and may be entered again later
+// with everything it loaded, so onEnter is the place to catch up on what changed in between.
+class Scene {
+public:
+    virtual ~Scene() = default;
+
+    // Called whenever the scene becomes the top of the stack: when pushed, resumed or uncovered by a pop.
+    virtual void onEnter() {}
+
+    // Called whenever the scene stops being the top: when covered by a push or popped.
+    virtual void onExit() {}
+
+    // Returns true once the scene has asked to be closed (ESC, a Back option...).
+    bool isCloseRequested() const { return closeRequested; }
+
+protected:
+    // Asks the owner to pop the scene (honoured after the current input is handled).
+    void requestClose() { closeRequested = true; }
+
+private:
+    friend class SceneStack;
+
+    bool closeRequested = false; // Set by requestClose(), cleared when the scene is popped.
+};
@@ -0,0 +1,71 @@
+#include "SceneStack.h"
+#include <algorithm>
+
+SceneStack::SceneStack(std::size_t poolLimit)
+    : poolLimit(poolLimit) {
+}
+
+void SceneStack::push(GameState state, const std::string& key, std::unique_ptr<Scene> scene) {
+    if (!scene)
+        return;
+    dropSuspended(key);
+    if (!stack.empty())
+        stack.back().scene->onExit();
+    stack.push_back({ state, key, std::move(scene) });
+    stack.back().scene->onEnter();
+}
+
+bool SceneStack::resume(const std::string& key) {
+    auto it = std::find_if(pool.begin(), pool.end(), [&](const Entry& entry) { return entry.key == key; });
+    if (it == pool.end())
+        return false;
+    Entry entry = std::move(*it);
+    pool.erase(it);
+    if (!stack.empty())
+        stack.back().scene->onExit();
+    stack.push_back(std::move(entry));
+    stack.back().scene->onEnter();
+    return true;
+}
+
+void SceneStack::pop() {
+    if (stack.empty())
+        return;
+    Entry entry = std::move(stack.back());
+    stack.pop_back();
+    entry.scene->onExit();
+    entry.scene->closeRequested = false;
+    pool.push_back(std::move(entry));
+    if (pool.size() > poolLimit)
+        pool.erase(pool.begin());
+
+    if (!stack.empty())
+        stack.back().scene->onEnter();
+}
+
+bool SceneStack::popClosed() {
+    if (stack.empty() || !stack.back().scene->isCloseRequested())
+        return false;
+    pop();
+    return true;
+}
+
+void SceneStack::clear() {
+    if (!stack.empty())
+        stack.back().scene->onExit();
+    // Top first, so no scene outlives one pushed on top of it
+    while (!stack.empty())
+        stack.pop_back();
+    pool.clear();
+}
+
+bool SceneStack::evictOldest() {
+    if (pool.empty())
+        return false;
+    pool.erase(pool.begin());
+    return true;
+}
+
+void SceneStack::dropSuspended(const std::string& key) {
+    pool.erase(std::remove_if(pool.begin(), pool.end(), [&](const Entry& entry) { return entry.key == key; }), pool.end());
+}
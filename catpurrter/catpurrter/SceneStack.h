@@ -0,0 +1,73 @@
+#pragma once
+#include "GameState.h"
+#include "Scene.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+// SceneStack owns the game's screens. The scene on top gets the input and the frames; the ones under it
+// (the room under the computer under a shop) stay alive and come back exactly as they were when the top
+// is popped. Popped scenes aren't deleted either: they're suspended in a pool under their key, and resume()
+// puts them back on top, so opening a view or a shop again reuses everything it already built.
+// The pool is trimmed oldest first when it outgrows its limit, or by the owner when memory runs short.
+class SceneStack {
+public:
+    // Creates an empty stack keeping at most poolLimit suspended scenes.
+    explicit SceneStack(std::size_t poolLimit = 8);
+
+    // Pushes a new scene for state under key (replacing a suspended scene with the same key).
+    void push(GameState state, const std::string& key, std::unique_ptr<Scene> scene);
+
+    // Moves the suspended scene with key back on top; returns false if there is none.
+    bool resume(const std::string& key);
+
+    // Pops the top scene into the pool.
+    void pop();
+
+    // Pops the top scene if it asked to close; returns true if it did.
+    bool popClosed();
+
+    // Destroys every scene, on the stack and suspended (another save was loaded).
+    void clear();
+
+    // Destroys the least recently suspended scene; returns false if the pool is empty.
+    bool evictOldest();
+
+    // Returns true if no scene is on the stack.
+    bool empty() const { return stack.empty(); }
+
+    // Returns the state of the top scene, or fallback if the stack is empty.
+    GameState topState(GameState fallback) const { return stack.empty() ? fallback : stack.back().state; }
+
+    // Returns the top scene as a T (nullptr if the stack is empty or the top is something else).
+    template<typename T>
+    T* topAs() const { return stack.empty() ? nullptr : dynamic_cast<T*>(stack.back().scene.get()); }
+
+    // Returns the scene with key on the stack as a T (nullptr if it isn't on the stack).
+    template<typename T>
+    T* find(const std::string& key) const {
+        for (const Entry& entry : stack) {
+            if (entry.key == key)
+                return dynamic_cast<T*>(entry.scene.get());
+        }
+        return nullptr;
+    }
+
+    // Returns how many scenes are suspended.
+    std::size_t getSuspendedCount() const { return pool.size(); }
+
+private:
+    // A scene and what it is known by.
+    struct Entry {
+        GameState state;              // Screen the scene is shown as.
+        std::string key;              // Name it's pooled under (usually the state's name).
+        std::unique_ptr<Scene> scene; // The scene itself.
+    };
+
+    // Removes the pooled entry with key, if any.
+    void dropSuspended(const std::string& key);
+
+    std::vector<Entry> stack;  // Active scenes, bottom first.
+    std::vector<Entry> pool;   // Suspended scenes, least recently suspended first.
+    std::size_t poolLimit;     // Most scenes kept in the pool.
+};
@@ -0,0 +1,37 @@
+#include "Settings.h"
+#include "json.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+using json = nlohmann::json;
+
+bool Settings::loadFromFile(const std::string& filename) {
+    if (!std::filesystem::exists(filename))
+        return false;
+
+    std::ifstream inFile(filename);
+    if (!inFile.is_open())
+        return false;
+
+    json data = json::parse(inFile, nullptr, false);
+    if (data.is_discarded() || !data.is_object()) {
+        std::cerr << "Settings file is broken, using defaults: " << filename << std::endl;
+        return false;
+    }
+
+    if (data.contains("textureBudgetMB") && data["textureBudgetMB"].is_number_integer())
+        textureBudgetMB = std::max(0, data["textureBudgetMB"].get<int>());
+    if (data.contains("frameRateCap") && data["frameRateCap"].is_number_integer())
+        frameRateCap = std::max(0, data["frameRateCap"].get<int>());
+    if (data.contains("vsync") && data["vsync"].is_boolean())
+        vsync = data["vsync"].get<bool>();
+    if (data.contains("dynamicResolution") && data["dynamicResolution"].is_boolean())
+        dynamicResolution = data["dynamicResolution"].get<bool>();
+    if (data.contains("renderBudgetMs") && data["renderBudgetMs"].is_number())
+        renderBudgetMs = std::max(1.f, data["renderBudgetMs"].get<float>());
+    if (data.contains("minRenderScale") && data["minRenderScale"].is_number())
+        minRenderScale = std::clamp(data["minRenderScale"].get<float>(), 0.1f, 1.f);
+    return true;
+}
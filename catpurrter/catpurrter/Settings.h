@@ -0,0 +1,21 @@
+#pragma once
+#include <string>
+
+// Settings holds the user-tunable options read from settings.json next to the executable.
+// A missing file or key keeps the default, so the game runs fine without one.
+class Settings {
+public:
+    // --- Options ---
+
+    int textureBudgetMB = 64; // Texture memory the AssetCache may keep resident before evicting (0 = no limit).
+    int frameRateCap = 60;    // Frames per second the main loop holds (e.g. 60, 120, 144; 0 = uncapped).
+    bool vsync = false;       // Let the display pace frames instead of the frame cap.
+    bool dynamicResolution = true; // Lower the world's render resolution when frames take longer than renderBudgetMs.
+    float renderBudgetMs = 12.f;   // Render time per frame the dynamic resolution aims to stay under.
+    float minRenderScale = 0.5f;   // Lowest world resolution scale (fraction of the window's pixels).
+
+    // --- Persistence Methods ---
+
+    // Reads the options present in the given file (returns false if it's missing or broken).
+    bool loadFromFile(const std::string& filename);
+};
@@ -1,17 +1,23 @@
 #include "Shelf.h"
+#include "AssetCache.h"
 #include <iostream>
 
 Shelf::Shelf(const sf::Font& font, Player& player)
     : font(font), playerData(player) {
 }
 
+AssetList Shelf::requiredAssets(const Player&) {
+    return { { "assets/graphics/shelves/shelvesclose.png" }, { "closeup" } };
+}
+
 void Shelf::init() {
-    if (!shelfBackgroundTexture.loadFromFile("assets/graphics/shelves/shelvesclose.png")) {
-        std::cout << "Failed to load shelvesclose.png!\n";
-    }
-    shelfBackgroundSprite.setTexture(shelfBackgroundTexture);
+    AssetCache& assets = AssetCache::instance();
+    builtVersion = playerData.inventoryVersion;
+    shelfBackgroundTexture = assets.getTexture("assets/graphics/shelves/shelvesclose.png");
+    if (shelfBackgroundTexture)
+        shelfBackgroundSprite.setTexture(*shelfBackgroundTexture);
 
-    bigDecorationTextures.clear();
+    atlas = assets.getAtlas("closeup");
     bigDecorationSprites.clear();
 
  std::vector<sf::Vector2f> shelfPositions = {
@@ -23,11 +29,8 @@ void Shelf::init() {
 
  size_t idx = 0;
  for (const std::string& decoId : playerData.ownedDecorations) {
-     std::string path = "assets/graphics/shelves/" + decoId + "big.png";
-     sf::Texture tex;
-     if (tex.loadFromFile(path)) {
-         bigDecorationTextures[decoId] = tex;
-         sf::Sprite spr(bigDecorationTextures[decoId]);
+     sf::Sprite spr;
+     if (atlas && atlas->apply(spr, decoId + "big")) {
          if (idx < shelfPositions.size()) {
              spr.setPosition(shelfPositions[idx]);
          }
@@ -48,17 +51,16 @@ void Shelf::update() {
     }
 }
 
-void Shelf::render(sf::RenderWindow& window) {
-    window.draw(shelfBackgroundSprite);
+void Shelf::render(DrawList& target) {
+    target.draw(shelfBackgroundSprite);
 
     for (const auto& spr : bigDecorationSprites) {
-        window.draw(spr);
+        target.draw(spr);
     }
+}
 
-    sf::Text title;
-    title.setFont(font);
-    title.setString("Your Shelf Decorations");
-    title.setCharacterSize(30);
+void Shelf::renderUi(DrawList& window) {
+    sf::Text& title = texts.get("Your Shelf Decorations", font, 30);
     title.setFillColor(sf::Color::Cyan);
     title.setPosition(40.f, 20.f);
     window.draw(title);
@@ -68,7 +70,7 @@ void Shelf::render(sf::RenderWindow& window) {
 
 void Shelf::handleInput(sf::Keyboard::Key key) {
     if (key == sf::Keyboard::Escape) {
-        closeRequested = true;
+        requestClose();
         return;
     }
 
@@ -86,10 +88,7 @@ void Shelf::handleInput(sf::Keyboard::Key key) {
     }
 }
 
-bool Shelf::shouldClose() const {
-    return closeRequested;
-}
-
-void Shelf::resetCloseFlag() {
-    closeRequested = false;
+void Shelf::onEnter() {
+    if (builtVersion != playerData.inventoryVersion)
+        init();
 }
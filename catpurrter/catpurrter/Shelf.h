@@ -1,11 +1,18 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "DrawList.h"
 #include "Player.h"
+#include "AssetCache.h"
+#include "SpriteAtlas.h"
+#include "TextCache.h"
+#include "Scene.h"
+#include <map>
+#include <memory>
 
 // Shelf displays a fullscreen view of the player's owned shelf decorations.
 // It shows large versions of decorations the player has purchased and placed on the shelf.
 // Allows selection (for future expansion) and handles closing the view.
-class Shelf {
+class Shelf : public Scene {
 public:
     // Constructs the Shelf view with the game's font and reference to the player's data.
     Shelf(const sf::Font& font, Player& player);
@@ -13,32 +20,36 @@ public:
     // Initializes the shelf state (loads background and decoration textures, sets positions).
     void init();
 
+    // Returns the textures and atlases init() uses, so they can be prefetched before the view opens.
+    static AssetList requiredAssets(const Player& player);
+
     // Updates selection highlight for the decorations list (for possible selection interaction).
     void update();
 
-    // Draws the shelf background, all big decorations, and the title to the window.
-    void render(sf::RenderWindow& window);
+    // Draws the shelf background and all big decorations (the world pass, may be drawn at reduced resolution).
+    void render(DrawList& target);
+
+    // Draws the title on top at native resolution.
+    void renderUi(DrawList& target);
 
     // Handles keyboard input for navigating decorations (W/S or Up/Down), selecting, or closing (ESC).
     void handleInput(sf::Keyboard::Key key);
 
-    // Returns true if the user has requested to close the shelf view.
-    bool shouldClose() const;
-
-    // Resets the close flag so the view won't immediately close when reopened.
-    void resetCloseFlag();
+    // Rebuilds the view if the player's decorations changed while it was suspended.
+    void onEnter() override;
 
 private:
     const sf::Font& font;            // Reference to the font for drawing text.
+    TextCache texts;                 // Title text, kept laid out between frames.
     Player& playerData;              // Reference to player data (owns the decorations).
 
     std::vector<sf::Text> decorationTexts;   // List of decoration names for potential selection/highlight.
     int selectionIndex = 0;                  // Currently highlighted decoration (if used for selection).
-    bool closeRequested = false;             // True if the player pressed ESC to exit.
 
-    sf::Texture shelfBackgroundTexture;      // Texture for the shelf background image.
+    std::shared_ptr<sf::Texture> shelfBackgroundTexture; // Texture for the shelf background image.
     sf::Sprite shelfBackgroundSprite;        // Sprite for drawing the shelf background.
 
-    std::map<std::string, sf::Texture> bigDecorationTextures;  // Textures for big decoration images (by id).
+    std::shared_ptr<SpriteAtlas> atlas;                     // Close-up atlas holding the big decorations.
+    unsigned builtVersion = 0;                              // Player::inventoryVersion init() built the view for.
     std::vector<sf::Sprite> bigDecorationSprites;              // Sprites for each big decoration displayed.
 };
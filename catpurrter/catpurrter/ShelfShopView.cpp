@@ -18,48 +18,22 @@ ShelfShopView::ShelfShopView(sf::Font& font, Player& player, GameManager* gm)
         {"picture", "Picture of Cool Cat", 40}
     };
 
-    float y = 150.f;
-    for (const auto& deco : decorations) {
-        sf::Text option;
-        option.setFont(font);
-        option.setCharacterSize(28);
-        option.setPosition(100.f, y);
-        decorationOptions.push_back(option);
-        y += 50.f;
-    }
-
-    updateOptionColors();
+    init();
 }
 
 void ShelfShopView::init() {
-    decorationOptions.clear();
-    float y = 150.f;
-
-    for (const auto& deco : decorations) {
-        sf::Text option;
-        option.setFont(font);
-        option.setCharacterSize(28);
-        option.setPosition(100.f, y);
-        decorationOptions.push_back(option);
-        y += 50.f;
-    }
-
-    updateOptionColors();
+    optionList.setup(font, 28, { 100.f, 150.f }, 50.f);
+    refreshOptions();
 }
 
 void ShelfShopView::handleInput(sf::Keyboard::Key key) {
     if (key == sf::Keyboard::Escape) {
-        closeFlag = true;
+        requestClose();
         return;
     }
 
-    if (key == sf::Keyboard::Up || key == sf::Keyboard::W) {
-        if (selectedIndex > 0) selectedIndex--;
-    }
-    else if (key == sf::Keyboard::Down || key == sf::Keyboard::S) {
-        if (selectedIndex < static_cast<int>(decorations.size()) - 1) selectedIndex++;
-    }
-    else if (key == sf::Keyboard::Enter) {
+    if (optionList.handleKey(key)) {
+        const int selectedIndex = optionList.getSelected();
         const std::string& selectedId = std::get<0>(decorations[selectedIndex]);
         int price = std::get<2>(decorations[selectedIndex]);
 
@@ -71,21 +45,22 @@ void ShelfShopView::handleInput(sf::Keyboard::Key key) {
         else if (playerData.coins >= price) {
             playerData.coins -= price;
             playerData.ownedDecorations.push_back(selectedId);
+            playerData.markInventoryChanged();
             std::thread saveThread([&]() {
                 playerData.saveToFile("saves/save.json");
                 });
             saveThread.detach();
             std::cout << "Bought decoration: " << selectedId << "\n";
+            refreshOptions();
         }
         else {
             std::cout << "Not enough coins\n";
         }
     }
-
-    updateOptionColors();
 }
 
-void ShelfShopView::updateOptionColors() {
+void ShelfShopView::refreshOptions() {
+    std::vector<std::string> labels;
     for (size_t i = 0; i < decorations.size(); ++i) {
         const auto& [id, label, price] = decorations[i];
 
@@ -95,13 +70,13 @@ void ShelfShopView::updateOptionColors() {
         if (owned)
             display += " (Owned)";
 
-        decorationOptions[i].setString(display);
-        decorationOptions[i].setFillColor(i == selectedIndex ? sf::Color::Yellow : sf::Color::White);
+        labels.push_back(display);
     }
+    optionList.setItems(labels);
 }
 
-void ShelfShopView::render(sf::RenderWindow& window) {
-    sf::RectangleShape bg(sf::Vector2f(static_cast<float>(window.getSize().x), static_cast<float>(window.getSize().y)));
+void ShelfShopView::render(DrawList& window) {
+    sf::RectangleShape bg(window.getView().getSize());
 
     bg.setFillColor(sf::Color(120, 60, 200));
     window.draw(bg);
@@ -109,14 +84,5 @@ void ShelfShopView::render(sf::RenderWindow& window) {
     gameManager->drawSectionTitle(window, font, "Shelf Shop");
     gameManager->drawCoinDisplay(window, font, playerData.coins);
 
-    for (const auto& opt : decorationOptions)
-        window.draw(opt);
+    optionList.render(window);
 }
-
-bool ShelfShopView::shouldClose() const {
-    return closeFlag; 
-}
-
-void ShelfShopView::resetCloseFlag() {
-    closeFlag = false; 
-}
\ No newline at end of file
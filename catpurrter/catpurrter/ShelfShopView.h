@@ -20,21 +20,13 @@ public:
     void handleInput(sf::Keyboard::Key key) override;
 
     // Draws the shop background, menu, and all decoration options.
-    void render(sf::RenderWindow& window) override;
-
-    // Returns true if the player requested to close/exit the shop.
-    bool shouldClose() const override;
-
-    // Resets the close flag so the view can be reopened.
-    void resetCloseFlag() override;
+    void render(DrawList& window) override;
 
 private:
     // List of decorations for sale: tuple of (id, display name, price)
     std::vector<std::tuple<std::string, std::string, int>> decorations;
 
-    // Text for displaying each decoration option on screen
-    std::vector<sf::Text> decorationOptions;
 
-    // Updates option colors and ownership status.
-    void updateOptionColors() override;
+    // Rebuilds the option labels, marking the ones already owned.
+    void refreshOptions() override;
 };
@@ -2,6 +2,9 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <string>
+#include "TextCache.h"
+#include "Widgets.h"
+#include "Scene.h"
 
 // ShopSelection is an enum for all possible shop categories the player can select.
 enum class ShopSelection {
@@ -15,7 +18,7 @@ enum class ShopSelection {
 
 // ShopCategoryView displays a list of all shop categories for the player to choose from.
 // Handles input, menu navigation, and selection.
-class ShopCategoryView {
+class ShopCategoryView : public Scene {
 public:
     // Constructs the shop category menu using the game's font.
     ShopCategoryView(const sf::Font& fontRef);
@@ -23,34 +26,24 @@ public:
     // Initializes the list of shop options and resets selection state.
     void init();
 
-    // Updates highlight colors for currently selected option.
-    void update();
-
     // Clears the selection (sets selection to None).
     void clearSelection();
 
     // Draws the shop category menu (background, title, and all options).
-    void render(sf::RenderWindow& window);
+    void render(DrawList& window);
 
     // Handles keyboard input for menu navigation, selecting, and closing.
     void handleInput(sf::Keyboard::Key key);
 
-    // Returns true if the player requested to close/exit the menu.
-    bool shouldClose() const;
-
-    // Resets the close flag so the view can be reopened.
-    void resetCloseFlag();
-
     // Returns the current selection (which shop, or None).
     ShopSelection getSelectedOption() const;
 
     // Directly set the selection index for menu.
-    void setSelectionIndex(int idx) { selectionIndex = idx; }
+    void setSelectionIndex(int idx) { options.setSelected(idx); }
 
 private:
     const sf::Font& font;           // Reference to the game's font for drawing text
-    std::vector<sf::Text> options;  // List of shop option menu items
-    int selectionIndex = 0;         // Which menu option is currently selected/highlighted
-    bool closeRequested = false;    // True if ESC or Back was pressed
+    TextCache texts;                // Title text (options are kept in options already)
+    ListView options;               // Shop option menu items and the highlighted one
     ShopSelection selected = ShopSelection::None; // What the player selected
 };
@@ -1,13 +1,15 @@
 #pragma once
 #include <SFML/Graphics.hpp>
 #include "Player.h"
+#include "Widgets.h"
+#include "Scene.h"
 
 // Forward declaration to avoid circular dependency
 class GameManager;
 
 // ShopViewBase is an abstract base class for all shop screens (hats, shelf, fish tank, mini-games).
 // Provides a common interface and shared member variables for input, option selection, and rendering.
-class ShopViewBase {
+class ShopViewBase : public Scene {
 public:
     virtual ~ShopViewBase() = default;
 
@@ -15,19 +17,16 @@ public:
     virtual void init() = 0;
 
     // Draws the shop's UI/menu to the given window.
-    virtual void render(sf::RenderWindow& window) = 0;
+    virtual void render(DrawList& window) = 0;
 
     // Handles keyboard input for navigating/buying/closing the shop.
     virtual void handleInput(sf::Keyboard::Key key) = 0;
 
-    // Returns true if the player requested to close/exit the shop.
-    virtual bool shouldClose() const = 0;
+    // Rebuilds the option labels (prices, owned marks) after init or a purchase.
+    virtual void refreshOptions() = 0;
 
-    // Resets the close flag so the shop can be reopened.
-    virtual void resetCloseFlag() = 0;
-
-    // Updates which options are highlighted/owned (after input or purchase).
-    virtual void updateOptionColors() = 0;
+    // Updates the owned marks, which other shops or views may have changed while the shop was suspended.
+    void onEnter() override { refreshOptions(); }
 
 protected:
     // Base constructor: takes a reference to the game's font, player data, and game manager.
@@ -38,6 +37,5 @@ protected:
     sf::Font& font;                 // Reference to the game's font for UI
     Player& playerData;             // Reference to the player's data (coins, inventory, etc.)
     GameManager* gameManager;       // Pointer to the main game manager (for callbacks, etc.)
-    int selectedIndex = 0;          // Which shop menu option is currently highlighted/selected
-    bool closeFlag = false;         // True if ESC/exit has been requested
+    ListView optionList;            // Shop item rows; keeps which one is highlighted
 };
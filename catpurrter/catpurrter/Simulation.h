@@ -0,0 +1,23 @@
+#pragma once
+#include "InputState.h"
+
+// Simulation is the rules of a game or screen with its pictures taken out: state that moves on one fixed
+// step at a time from the keys of that step, and nothing else. No window, no textures, no clock; the
+// screens draw a simulation and wrap it in their menus, and catpurrter_sim runs one as fast as it can.
+// Two simulations reset with the same seed and fed the same steps end up in the same state.
+class Simulation {
+public:
+    virtual ~Simulation() = default;
+
+    // Starts a new round; the simulation's random numbers come from seed.
+    virtual void reset(unsigned seed) = 0;
+
+    // Advances one step of dt seconds; input holds the keys of that step.
+    virtual void step(float dt, const InputState& input) = 0;
+
+    // Returns true once the round has ended (until the next reset). Screens that can't end never are.
+    virtual bool isOver() const { return false; }
+
+    // Returns the round's score so far.
+    virtual int getScore() const { return 0; }
+};
@@ -1,5 +1,8 @@
 #pragma once
 #include "MiniGameBase.h"
+#include "TextCache.h"
+#include "MiniGameScreens.h"
+#include "SnakeSim.h"
 #include <SFML/Graphics.hpp>
 #include <deque>
 #include <random>
@@ -19,7 +22,7 @@ enum class SnakeGameState {
 };
 
 // SnakeGame implements the classic Snake mini-game, playable from your game's computer desktop.
-// Handles all game logic, rendering, menus, pause/game over, input, and scoring/coin rewards.
+// The rules live in a SnakeSim; this adds the menus, pause/game over, drawing and the coin rewards.
 class SnakeGame : public MiniGameBase {
 public:
     // Creates the SnakeGame with font for drawing, references to player and game manager.
@@ -29,21 +32,17 @@ public:
     void init() override;
 
     // Updates game logic, movement, collision, scoring, etc.
-    // dt: time elapsed since last frame (seconds)
-    void update(float dt) override;
+    // dt: length of one simulation step (seconds)
+    // input: direction keys pressed during the step (passed on to the SnakeSim)
+    void update(float dt, const InputState& input) override;
 
     // Draws the current state (menu, gameplay, paused, game over, etc) to the window.
-    void render(sf::RenderWindow& window) override;
+    // The snake moves a whole cell at a time, so there's nothing to interpolate.
+    void render(DrawList& window, float alpha) override;
 
     // Handles keyboard input for controlling the snake, navigating menus, pausing, etc.
     void handleInput(sf::Keyboard::Key key) override;
 
-    // Returns true if player requested to exit the Snake mini-game.
-    bool shouldClose() const override { return closeRequested; }
-
-    // Resets the close flag for when game is opened again.
-    void resetCloseFlag() override { closeRequested = false; }
-
     // Returns the number of coins earned in the last completed game session.
     int getCoinsEarned() const override { return coinsEarned; }
 
@@ -51,48 +50,34 @@ public:
     bool finishedGame() const override { return state == SnakeGameState::GameOver; }
 
 private:
-    int gameOverIndex = 0; // For game over menu: 0=Restart, 1=Back to menu
-
     // Renders the game over screen and options.
-    void drawGameOver(sf::RenderWindow& window);
+    void drawGameOver(DrawList& window);
 
     bool coinsAdded = false; // True if coins for this game have been awarded to player
 
     // Game logic helpers
     void resetGame();               // Resets the game state for new or replay session
-    void spawnFood();               // Places a new food item on the board
-    void moveSnake();               // Moves the snake by one grid space
+    void buildScreens();            // Lays out the menu, instructions, pause and game over screens
 
     // UI drawing helpers
-    void drawMenu(sf::RenderWindow& window);          // Draws main menu
-    void drawGame(sf::RenderWindow& window);          // Draws the play area, snake, food, and score
-    void drawPause(sf::RenderWindow& window);         // Draws pause menu overlay
-    void drawInstructions(sf::RenderWindow& window);  // Draws the how-to-play instructions
+    void drawMenu(DrawList& window);          // Draws main menu
+    void drawGame(DrawList& window);          // Draws the play area, snake, food, and score
+    void drawPause(DrawList& window);         // Draws pause menu overlay
+    void drawInstructions(DrawList& window);  // Draws the how-to-play instructions
 
     Player& player;                // Reference to player data (for coin rewards)
     GameManager& gameManager;      // Reference to main game manager (if needed)
 
     const sf::Font& font;          // Reference to game's font for UI rendering
+    TextCache texts;               // Laid-out menu, score and popup text (kept between frames)
     SnakeGameState state = SnakeGameState::MainMenu; // Current game/menu state
 
-    sf::Vector2i direction = { 1, 0 };     // Current movement direction of the snake
-    sf::Vector2i nextDirection = { 1, 0 }; // Next direction (set by input)
-    std::deque<sf::Vector2i> snake;        // Snake body segments (front is the head)
-    sf::Vector2i food;                     // Position of the food on the grid
-
-    int gridWidth = 20;        // Board width (tiles)
-    int gridHeight = 16;       // Board height (tiles)
+    SnakeSim sim;              // The snake, the food and the score
     int tileSize = 24;         // Size of each grid tile (pixels)
-    float moveTimer = 0;       // Time accumulator for snake movement
-    float moveDelay = 0.12f;   // Delay (seconds) between snake moves (controls speed)
 
-    bool closeRequested = false; // True if player pressed ESC or exited via menu
     bool gameOver = false;       // True if game ended (collision)
     bool gameFinished = false;   // True if a play session is over
-    int score = 0;               // Current score (number of foods eaten)
     int coinsEarned = 0;         // Number of coins earned in last play session
 
-    // Menu and pause navigation indices
-    int menuIndex = 0;  // 0=Play, 1=Instructions, 2=Exit (main menu)
-    int pauseIndex = 0; // 0=Resume, 1=Exit (pause menu)
+    MiniGameScreens screens;     // Menu, pause and game over widgets (and their selected options)
 };
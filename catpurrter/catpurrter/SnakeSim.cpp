@@ -0,0 +1,74 @@
+#include "SnakeSim.h"
+#include <algorithm>
+
+void SnakeSim::reset(unsigned seed) {
+    rng.seed(seed);
+    snake.clear();
+    snake.push_back({ GRID_WIDTH / 2, GRID_HEIGHT / 2 });
+    direction = { 1, 0 };
+    turns.clear();
+    moveTimer = 0.f;
+    score = 0;
+    over = false;
+    spawnFood();
+}
+
+void SnakeSim::step(float dt, const InputState& input) {
+    if (over)
+        return;
+
+    // Two quick presses between moves are two turns, not just the last one
+    if (input.wasPressed(Action::MoveUp)) queueTurn({ 0, -1 });
+    if (input.wasPressed(Action::MoveDown)) queueTurn({ 0, 1 });
+    if (input.wasPressed(Action::MoveLeft)) queueTurn({ -1, 0 });
+    if (input.wasPressed(Action::MoveRight)) queueTurn({ 1, 0 });
+
+    moveTimer += dt;
+    if (moveTimer >= MOVE_DELAY) {
+        moveTimer -= MOVE_DELAY; // Keep the overshoot, so the snake's pace doesn't depend on the step length
+        move();
+    }
+}
+
+void SnakeSim::queueTurn(sf::Vector2i turn) {
+    // Checked against the direction the snake will have when this turn is taken
+    const sf::Vector2i heading = turns.empty() ? direction : turns.back();
+    if (turn == heading || turn == -heading || turns.size() >= MAX_QUEUED_TURNS)
+        return;
+    turns.push_back(turn);
+}
+
+void SnakeSim::move() {
+    if (!turns.empty()) {
+        direction = turns.front();
+        turns.pop_front();
+    }
+    sf::Vector2i newHead = snake.front() + direction;
+
+    // Walls and the snake's own body end the round
+    if (newHead.x < 0 || newHead.x >= GRID_WIDTH || newHead.y < 0 || newHead.y >= GRID_HEIGHT ||
+        std::find(snake.begin(), snake.end(), newHead) != snake.end()) {
+        over = true;
+        return;
+    }
+
+    snake.push_front(newHead);
+    if (newHead == food) {
+        score++;
+        spawnFood();
+    }
+    else {
+        snake.pop_back();
+    }
+}
+
+void SnakeSim::spawnFood() {
+    // A snake filling the whole board has nowhere left to put food
+    if (snake.size() >= static_cast<std::size_t>(GRID_WIDTH * GRID_HEIGHT))
+        return;
+    std::uniform_int_distribution<int> xDist(0, GRID_WIDTH - 1);
+    std::uniform_int_distribution<int> yDist(0, GRID_HEIGHT - 1);
+    do {
+        food = { xDist(rng), yDist(rng) };
+    } while (std::find(snake.begin(), snake.end(), food) != snake.end());
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <SFML/System/Vector2.hpp>
+#include "Simulation.h"
+#include <deque>
+#include <random>
+
+// SnakeSim is Snake's rules: the snake on its grid, the food, the turns waiting to be taken and the score.
+// The snake moves one cell every MOVE_DELAY seconds; direction keys pressed in between are queued as turns
+// (at most MAX_QUEUED_TURNS), one taken per move, so quick presses aren't lost. The round ends when the
+// head leaves the grid or runs into the body.
+class SnakeSim : public Simulation {
+public:
+    static const int GRID_WIDTH = 20;             // Board width (cells).
+    static const int GRID_HEIGHT = 16;            // Board height (cells).
+    static constexpr float MOVE_DELAY = 0.12f;    // Seconds between moves.
+    static const std::size_t MAX_QUEUED_TURNS = 3; // Most turns waiting; further presses are dropped.
+
+    // Puts a one-cell snake in the middle heading right and places the food.
+    void reset(unsigned seed) override;
+
+    // Queues the turns pressed in the step and moves the snake when its delay is up.
+    void step(float dt, const InputState& input) override;
+
+    // Returns true once the snake has crashed.
+    bool isOver() const override { return over; }
+
+    // Returns the number of foods eaten.
+    int getScore() const override { return score; }
+
+    // Returns the snake's cells, head first.
+    const std::deque<sf::Vector2i>& getSnake() const { return snake; }
+
+    // Returns the food's cell.
+    sf::Vector2i getFood() const { return food; }
+
+private:
+    // Queues a direction change (ignored if it's no change or a reversal of the heading it would follow).
+    void queueTurn(sf::Vector2i turn);
+
+    // Takes the oldest queued turn and moves the snake one cell, eating or crashing.
+    void move();
+
+    // Places the food on a free cell.
+    void spawnFood();
+
+    std::mt19937 rng;                      // Food placement.
+    std::deque<sf::Vector2i> snake;        // Body cells (front is the head).
+    sf::Vector2i direction = { 1, 0 };     // Current heading.
+    std::deque<sf::Vector2i> turns;        // Direction changes pressed but not taken yet, oldest first.
+    sf::Vector2i food;                     // Food cell.
+    float moveTimer = 0.f;                 // Time since the last move.
+    int score = 0;                         // Foods eaten.
+    bool over = false;                     // The snake has crashed.
+};
@@ -0,0 +1,135 @@
+#include "SpriteAtlas.h"
+#include "AtlasPacker.h"
+#include "AssetCache.h"
+#include "AssetLoader.h"
+#include "AssetPack.h"
+#include "json.hpp"
+
+#include <iostream>
+
+using json = nlohmann::json;
+
+namespace {
+    const std::string ATLAS_DIR = "assets/atlas";
+}
+
+bool SpriteAtlas::load(const std::string& name) {
+    pages.clear();
+    sprites.clear();
+
+    if (loadBaked(name))
+        return true;
+
+    std::cout << "Atlas '" << name << "' not baked (run assettool atlas), packing at runtime\n";
+    return packAtRuntime(name);
+}
+
+namespace {
+    // Reads assets/atlas/<name>.json; returns a discarded value if it's missing or broken.
+    json readTable(const std::string& name) {
+        const std::string tablePath = ATLAS_DIR + "/" + name + ".json";
+        const AssetPack& pack = AssetPack::instance();
+        if (!pack.exists(tablePath))
+            return json::value_t::discarded;
+
+        std::string text;
+        if (!pack.readFile(tablePath, text))
+            return json::value_t::discarded;
+
+        json data = json::parse(text, nullptr, false);
+        if (data.is_discarded() || !data.contains("pages") || !data.contains("sprites")) {
+            std::cout << "Atlas table is broken: " << tablePath << "\n";
+            return json::value_t::discarded;
+        }
+        return data;
+    }
+}
+
+std::vector<std::string> SpriteAtlas::bakedPagePaths(const std::string& name) {
+    std::vector<std::string> paths;
+    json data = readTable(name);
+    if (data.is_discarded())
+        return paths;
+    for (const auto& file : data["pages"])
+        paths.push_back(ATLAS_DIR + "/" + file.get<std::string>());
+    return paths;
+}
+
+bool SpriteAtlas::loadBaked(const std::string& name) {
+    json data = readTable(name);
+    if (data.is_discarded())
+        return false;
+
+    for (const auto& file : data["pages"]) {
+        auto tex = AssetCache::instance().getTexture(ATLAS_DIR + "/" + file.get<std::string>());
+        if (!tex) {
+            pages.clear();
+            return false;
+        }
+        pages.push_back(tex);
+    }
+
+    for (const auto& [id, entry] : data["sprites"].items()) {
+        unsigned page = entry["page"];
+        if (page >= pages.size()) continue;
+        AtlasSprite sprite;
+        sprite.texture = pages[page];
+        sprite.rect = sf::IntRect(entry["x"], entry["y"], entry["w"], entry["h"]);
+        if (entry.contains("base")) {
+            sprite.base = entry["base"];
+            sprite.offset = sf::Vector2i(entry.value("ox", 0), entry.value("oy", 0));
+        }
+        sprites[id] = sprite;
+    }
+    return !sprites.empty();
+}
+
+bool SpriteAtlas::packAtRuntime(const std::string& name) {
+    // Queue every sprite first so the worker threads decode them in parallel
+    AssetLoader& loader = AssetCache::instance().getLoader();
+    const std::vector<AtlasSource> sources = AtlasPacker::manifest(name);
+    for (const AtlasSource& source : sources)
+        loader.request(source.path);
+
+    AtlasPacker packer;
+    for (const AtlasSource& source : sources) {
+        if (auto image = loader.take(source.path))
+            packer.add(source, *image);
+    }
+    if (!packer.pack())
+        return false;
+
+    const auto& images = packer.getPages();
+    for (size_t i = 0; i < images.size(); ++i) {
+        auto tex = AssetCache::instance().storeTexture("atlas:" + name + "_" + std::to_string(i), images[i]);
+        if (!tex) {
+            pages.clear();
+            return false;
+        }
+        pages.push_back(tex);
+    }
+
+    for (const auto& [id, region] : packer.getRegions()) {
+        AtlasSprite sprite;
+        sprite.texture = pages[region.page];
+        sprite.rect = region.rect;
+        sprite.base = region.base;
+        sprite.offset = region.offset;
+        sprites[id] = sprite;
+    }
+    return !sprites.empty();
+}
+
+const AtlasSprite* SpriteAtlas::find(const std::string& id) const {
+    auto it = sprites.find(id);
+    return it != sprites.end() ? &it->second : nullptr;
+}
+
+bool SpriteAtlas::apply(sf::Sprite& sprite, const std::string& id, bool mirrored) const {
+    const AtlasSprite* entry = find(id);
+    if (!entry)
+        return false;
+    sprite.setTexture(*entry->texture);
+    sprite.setTextureRect(entry->textureRect(mirrored));
+    return true;
+}
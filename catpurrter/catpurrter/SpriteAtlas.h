@@ -0,0 +1,56 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// AtlasSprite is one sprite inside an atlas: the page texture it lives on and its sub-rectangle.
+struct AtlasSprite {
+    std::shared_ptr<sf::Texture> texture;  // Atlas page texture.
+    sf::IntRect rect;                      // Pixel rectangle of the sprite on that page.
+    std::string base;                      // Layers only: id of the sprite this one is drawn over ("" otherwise).
+    sf::Vector2i offset;                   // Layers only: position relative to the base sprite's top-left.
+
+    // Returns the texture rect to draw with: flipped horizontally when mirrored (SFML mirrors a negative-width rect).
+    sf::IntRect textureRect(bool mirrored) const {
+        return mirrored ? sf::IntRect(rect.left + rect.width, rect.top, -rect.width, rect.height) : rect;
+    }
+};
+
+// SpriteAtlas resolves sprite ids like "frog_right2" to a page texture and sub-rect.
+// Only right-facing art is stored; left-facing sprites are the same regions drawn mirrored.
+// Loads the atlas baked by assettool (assets/atlas/<name>.json + pages); if it hasn't been baked,
+// packs the same sprites in memory at load time so the game still draws from atlas pages.
+// Get atlases through AssetCache::getAtlas() so each one is loaded once per process.
+class SpriteAtlas {
+public:
+    // Loads the named atlas ("room", "closeup" or "aquarium"). Returns false if no sprite could be loaded.
+    bool load(const std::string& name);
+
+    // Returns the sprite with the given id, or nullptr if the atlas doesn't contain it.
+    const AtlasSprite* find(const std::string& id) const;
+
+    // Points the sprite at the atlas region for id, mirrored horizontally if asked.
+    // Returns false (sprite untouched) if id is unknown.
+    bool apply(sf::Sprite& sprite, const std::string& id, bool mirrored = false) const;
+
+    // Returns the page image paths of a baked atlas, or an empty list if the atlas hasn't been baked.
+    static std::vector<std::string> bakedPagePaths(const std::string& name);
+
+    // Returns how many page textures the atlas uses.
+    std::size_t getPageCount() const { return pages.size(); }
+
+    // Returns the page textures.
+    const std::vector<std::shared_ptr<sf::Texture>>& getPages() const { return pages; }
+
+private:
+    // Reads the baked UV table and page textures from assets/atlas.
+    bool loadBaked(const std::string& name);
+
+    // Packs the manifest sprites for this atlas in memory (used when nothing was baked).
+    bool packAtRuntime(const std::string& name);
+
+    std::vector<std::shared_ptr<sf::Texture>> pages;       // Page textures.
+    std::unordered_map<std::string, AtlasSprite> sprites;  // Sprites by id.
+};
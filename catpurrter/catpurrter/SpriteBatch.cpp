@@ -0,0 +1,79 @@
+#include "SpriteBatch.h"
+
+void SpriteBatch::add(const sf::Texture* texture, const sf::Vertex* triangles, std::size_t count, const sf::Transform& transform) {
+    if (count == 0)
+        return;
+    startRun(texture);
+    for (std::size_t i = 0; i < count; ++i) {
+        sf::Vertex vertex = triangles[i];
+        vertex.position = transform.transformPoint(vertex.position);
+        vertices.push_back(vertex);
+    }
+    runs.back().vertexCount += count;
+}
+
+void SpriteBatch::add(const sf::Texture* texture, const sf::IntRect& texRect, sf::Vector2f size,
+    const sf::Transform& transform, sf::Color color) {
+    startRun(texture);
+
+    const float left = static_cast<float>(texRect.left);
+    const float top = static_cast<float>(texRect.top);
+    const float right = left + static_cast<float>(texRect.width);
+    const float bottom = top + static_cast<float>(texRect.height);
+
+    const sf::Vertex topLeft(transform.transformPoint(0.f, 0.f), color, { left, top });
+    const sf::Vertex topRight(transform.transformPoint(size.x, 0.f), color, { right, top });
+    const sf::Vertex bottomLeft(transform.transformPoint(0.f, size.y), color, { left, bottom });
+    const sf::Vertex bottomRight(transform.transformPoint(size.x, size.y), color, { right, bottom });
+    vertices.push_back(topLeft);
+    vertices.push_back(topRight);
+    vertices.push_back(bottomLeft);
+    vertices.push_back(bottomLeft);
+    vertices.push_back(topRight);
+    vertices.push_back(bottomRight);
+    runs.back().vertexCount += 6;
+}
+
+void SpriteBatch::add(const sf::Sprite& sprite) {
+    // Like sf::Sprite, a sprite without a texture draws nothing
+    if (!sprite.getTexture())
+        return;
+    const sf::FloatRect bounds = sprite.getLocalBounds();
+    add(sprite.getTexture(), sprite.getTextureRect(), { bounds.width, bounds.height },
+        sprite.getTransform(), sprite.getColor());
+}
+
+void SpriteBatch::add(const sf::RectangleShape& rect) {
+    if (rect.getOutlineThickness() != 0.f) {
+        Run run;
+        run.outlined = &rect;
+        runs.push_back(run);
+        return;
+    }
+    add(rect.getTexture(), rect.getTextureRect(), rect.getSize(), rect.getTransform(), rect.getFillColor());
+}
+
+void SpriteBatch::startRun(const sf::Texture* texture) {
+    // Extend the last run when it uses the same texture, otherwise start a new one
+    if (!runs.empty() && !runs.back().outlined && runs.back().texture == texture)
+        return;
+    Run run;
+    run.texture = texture;
+    run.firstVertex = vertices.size();
+    runs.push_back(run);
+}
+
+void SpriteBatch::flush(DrawList& target) {
+    drawCalls = 0;
+    quadCount = vertices.size() / 6;
+    for (const Run& run : runs) {
+        if (run.outlined)
+            target.draw(*run.outlined);
+        else
+            target.drawTriangles(run.texture, &vertices[run.firstVertex], run.vertexCount);
+        drawCalls++;
+    }
+    // clear() keeps the capacity for the next frame
+    vertices.clear();
+    runs.clear();
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "DrawList.h"
+#include <vector>
+
+// SpriteBatch collects textured quads for a frame and draws them with as few draw calls as possible.
+// Submission order is kept: consecutive quads on the same texture (one atlas page) become a single
+// draw, and a texture change or an outlined rectangle starts a new run.
+// Since the room draws nearly everything from one atlas page, a whole frame is a handful of draws.
+// The vertex buffer is reused between frames, so steady-state batching doesn't allocate.
+class SpriteBatch {
+public:
+    // Queues one quad: texRect of texture (nullptr = untextured) mapped onto local bounds (0, 0, size),
+    // placed with transform. A negative texRect width draws it mirrored, like sf::Sprite.
+    void add(const sf::Texture* texture, const sf::IntRect& texRect, sf::Vector2f size,
+        const sf::Transform& transform, sf::Color color = sf::Color::White);
+
+    // Queues prebuilt triangles (e.g. a LayeredSprite's vertex array) sampling texture, placed with transform.
+    void add(const sf::Texture* texture, const sf::Vertex* triangles, std::size_t count, const sf::Transform& transform);
+
+    // Queues a sprite (texture, rect, transform and colour).
+    void add(const sf::Sprite& sprite);
+
+    // Queues a rectangle; outlined ones are recorded as shapes (the rectangle must outlive flush()).
+    void add(const sf::RectangleShape& rect);
+
+    // Records everything queued into a draw list and empties the batch.
+    void flush(DrawList& target);
+
+    // Returns the number of draw calls the last flush() made.
+    std::size_t getDrawCalls() const { return drawCalls; }
+
+    // Returns the number of quads the last flush() drew.
+    std::size_t getQuadCount() const { return quadCount; }
+
+private:
+    // A stretch of the queue drawn with one call: quads sharing a texture, or one outlined rectangle.
+    struct Run {
+        const sf::Texture* texture = nullptr;           // Texture of the quads.
+        std::size_t firstVertex = 0;                    // First vertex in vertices.
+        std::size_t vertexCount = 0;                    // Six per quad.
+        const sf::RectangleShape* outlined = nullptr;   // Set for outlined rectangle runs (no quads).
+    };
+
+    // Makes the last run a quad run on texture, starting a new run if it isn't one already.
+    void startRun(const sf::Texture* texture);
+
+    std::vector<sf::Vertex> vertices; // Quads of all runs, two triangles each.
+    std::vector<Run> runs;            // Runs in submission order.
+    std::size_t drawCalls = 0;        // Draw calls made by the last flush.
+    std::size_t quadCount = 0;        // Quads drawn by the last flush.
+};
@@ -0,0 +1,42 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// SpscQueue is a fixed-size ring buffer for exactly one producer thread and one consumer thread.
+// Neither side ever locks or waits: push() fails when the ring is full and front() returns nullptr
+// when it's empty. Each side only writes its own index, published with release and read with acquire,
+// so the consumer sees an item's contents once it sees the producer's index move past it.
+template<typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    // Producer: appends an item; returns false (dropping it) if the queue is full.
+    bool push(const T& item) {
+        const std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == Capacity)
+            return false;
+        slots[t & (Capacity - 1)] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer: returns the oldest item, or nullptr if the queue is empty. Valid until pop().
+    const T* front() const {
+        const std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire))
+            return nullptr;
+        return &slots[h & (Capacity - 1)];
+    }
+
+    // Consumer: removes the oldest item (the queue must not be empty).
+    void pop() {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+private:
+    std::array<T, Capacity> slots{};      // Items; indices wrap with the mask.
+    std::atomic<std::size_t> head{ 0 };   // Next item to read (written by the consumer only).
+    std::atomic<std::size_t> tail{ 0 };   // Next slot to write (written by the producer only).
+};
@@ -1,5 +1,6 @@
 #include "StorageRack.h"
 #include "GameManager.h"
+#include "AssetCache.h"
 #include <iostream>
 
 StorageRack::StorageRack(const sf::Font& font, Player& player, GameManager* gm)
@@ -7,11 +8,16 @@ StorageRack::StorageRack(const sf::Font& font, Player& player, GameManager* gm)
 }
 
 
+AssetList StorageRack::requiredAssets(const Player&) {
+    return { { "assets/graphics/storagerack/srclose.png" }, { "closeup" } };
+}
+
 void StorageRack::init() {
-    if (!backgroundTexture.loadFromFile("assets/graphics/storagerack/srclose.png")) {
-        std::cout << "Failed to load storage rack bg!\n";
-    }
-    backgroundSprite.setTexture(backgroundTexture);
+    AssetCache& assets = AssetCache::instance();
+    builtVersion = playerData.inventoryVersion;
+    backgroundTexture = assets.getTexture("assets/graphics/storagerack/srclose.png");
+    if (backgroundTexture)
+        backgroundSprite.setTexture(*backgroundTexture);
 
     hatPositions = {
         {190.f, 150.f},
@@ -20,15 +26,15 @@ void StorageRack::init() {
         {410.f, 340.f}
     };
 
+    atlas = assets.getAtlas("closeup");
     hatTextures.clear();
     for (const auto& hat : playerData.unlockedHats) {
-        sf::Texture tex;
-        std::string path = "assets/graphics/storagerack/" + hat + "big.png";
-        if (tex.loadFromFile(path)) {
-            hatTextures[hat] = tex;
+        const AtlasSprite* sprite = atlas ? atlas->find(hat + "big") : nullptr;
+        if (sprite) {
+            hatTextures[hat] = *sprite;
         }
         else {
-            std::cout << "Couldn't load hat: " << path << "\n";
+            std::cout << "Couldn't load hat: " << hat << "big\n";
         }
     }
     selectionIndex = 0; 
@@ -46,15 +52,16 @@ void StorageRack::update() {
    
 }
 
-void StorageRack::render(sf::RenderWindow& window) {
-    window.draw(backgroundSprite);
+void StorageRack::render(DrawList& target) {
+    target.draw(backgroundSprite);
 
     for (size_t i = 0; i < playerData.unlockedHats.size() && i < hatPositions.size(); ++i) {
         const auto& hatId = playerData.unlockedHats[i];
         auto it = hatTextures.find(hatId);
         if (it != hatTextures.end()) {
             sf::Sprite hatSprite;
-            hatSprite.setTexture(it->second);
+            hatSprite.setTexture(*it->second.texture);
+            hatSprite.setTextureRect(it->second.rect);
             hatSprite.setPosition(hatPositions[i]);
 
             if (hatId == playerData.equippedHat) {
@@ -64,31 +71,33 @@ void StorageRack::render(sf::RenderWindow& window) {
                 hatSprite.setColor(sf::Color::White); 
             }
 
-            window.draw(hatSprite);
-
-            if (i == selectionIndex) {
-                sf::RectangleShape selectOutline({
-                    hatSprite.getGlobalBounds().width,
-                    hatSprite.getGlobalBounds().height
-                    });
-                selectOutline.setPosition(hatSprite.getPosition());
-                selectOutline.setFillColor(sf::Color::Transparent);
-                selectOutline.setOutlineColor(sf::Color::Yellow);
-                selectOutline.setOutlineThickness(4.f);
-                window.draw(selectOutline);
-            }
+            target.draw(hatSprite);
         }
     }
+}
 
-    sf::Text info;
-    info.setFont(font);
-    info.setCharacterSize(28);
-    info.setFillColor(sf::Color::White);
+void StorageRack::renderUi(DrawList& window) {
+    const size_t selected = static_cast<size_t>(selectionIndex);
+    if (selectionIndex >= 0 && selected < playerData.unlockedHats.size() && selected < hatPositions.size()) {
+        auto it = hatTextures.find(playerData.unlockedHats[selected]);
+        if (it != hatTextures.end()) {
+            sf::RectangleShape selectOutline({
+                static_cast<float>(it->second.rect.width),
+                static_cast<float>(it->second.rect.height)
+                });
+            selectOutline.setPosition(hatPositions[selected]);
+            selectOutline.setFillColor(sf::Color::Transparent);
+            selectOutline.setOutlineColor(sf::Color::Yellow);
+            selectOutline.setOutlineThickness(4.f);
+            window.draw(selectOutline);
+        }
+    }
 
-    info.setString("Equipped: " + (playerData.equippedHat.empty() ? std::string("none") : playerData.equippedHat));
+    sf::Text& info = texts.slot("equipped", "Equipped: " + (playerData.equippedHat.empty() ? std::string("none") : playerData.equippedHat), font, 28);
+    info.setFillColor(sf::Color::White);
     sf::FloatRect textRect = info.getLocalBounds();
     info.setOrigin(textRect.width / 2.f, 0);
-    info.setPosition(window.getSize().x / 2.f, 30.f); 
+    info.setPosition(window.getView().getSize().x / 2.f, 30.f); 
     window.draw(info);
 
 }
@@ -96,7 +105,7 @@ void StorageRack::render(sf::RenderWindow& window) {
 void StorageRack::handleInput(sf::Keyboard::Key key) {
    
     if (key == sf::Keyboard::Escape) {   
-        closeRequested = true;
+        requestClose();
         return;
     }
 
@@ -131,16 +140,13 @@ void StorageRack::handleInput(sf::Keyboard::Key key) {
                 playerData.equippedHat = selectedHat;
                 std::cout << "Equipped hat: " << playerData.equippedHat << std::endl;
             }
+            playerData.markInventoryChanged();
             playerData.saveToFile("saves/save.json");
         }
     }
 }
 
-
-bool StorageRack::shouldClose() const {
-    return closeRequested;
-}
-
-void StorageRack::resetCloseFlag() {
-    closeRequested = false;
+void StorageRack::onEnter() {
+    if (builtVersion != playerData.inventoryVersion)
+        init();
 }
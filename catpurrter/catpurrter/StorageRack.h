@@ -1,6 +1,13 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "DrawList.h"
 #include "Player.h"
+#include "AssetCache.h"
+#include "SpriteAtlas.h"
+#include "TextCache.h"
+#include "Scene.h"
+#include <map>
+#include <memory>
 
 // Forward declaration to avoid circular dependency
 class GameManager;
@@ -8,7 +15,7 @@ class GameManager;
 // StorageRack displays a large view of the player's unlocked hats.
 // Allows the player to equip or unequip hats and shows which hat is currently equipped.
 // Handles user input, navigation, and rendering of the hats in a grid.
-class StorageRack {
+class StorageRack : public Scene {
 public:
     // Constructs the storage rack view with the game's font, player data, and game manager.
     StorageRack(const sf::Font& font, Player& player, GameManager* gm);
@@ -16,35 +23,40 @@ public:
     // Initializes the storage rack (loads background, hat textures, positions, etc.).
     void init();
 
+    // Returns the textures and atlases init() uses, so they can be prefetched before the view opens.
+    static AssetList requiredAssets(const Player& player);
+
     // Updates the selection highlight (not used for animation in this view, but present for consistency).
     void update();
 
-    // Draws the rack background, all hats, selection highlight, and equipped info to the window.
-    void render(sf::RenderWindow& window);
+    // Draws the rack background and all hats (the world pass, may be drawn at reduced resolution).
+    void render(DrawList& target);
+
+    // Draws the selection highlight and equipped info on top at native resolution.
+    void renderUi(DrawList& target);
 
     // Handles keyboard input for navigating hats, equipping/unequipping, and exiting (ESC).
     void handleInput(sf::Keyboard::Key key);
 
-    // Returns true if the user has requested to close this view.
-    bool shouldClose() const;
-
-    // Resets the close flag so the view won't immediately close next time it's opened.
-    void resetCloseFlag();
+    // Rebuilds the view if the player's hats changed while it was suspended.
+    void onEnter() override;
 
 private:
     const sf::Font& font;           // Reference to the game's font for drawing text.
+    TextCache texts;                // "Equipped: ..." line, re-laid out only when the hat changes.
     Player& playerData;             // Reference to player data (owns hats, knows equipped hat).
 
     GameManager* gameManager = nullptr; // Pointer to the main GameManager (not directly used here).
 
     std::vector<sf::Text> hatOptions;   // (Unused in implementation, can be used for future features or UI.)
     int selectionIndex = 0;             // Which hat is currently highlighted/selected.
-    bool closeRequested = false;        // True if the player pressed ESC to exit.
 
-    sf::Texture backgroundTexture;      // Texture for the rack background image.
+    std::shared_ptr<sf::Texture> backgroundTexture; // Texture for the rack background image.
     sf::Sprite backgroundSprite;        // Sprite for the rack background.
 
-    std::map<std::string, sf::Texture> hatTextures; // Textures for each unlocked hat (by id).
+    std::shared_ptr<SpriteAtlas> atlas;          // Close-up atlas holding the big hats.
+    unsigned builtVersion = 0;                   // Player::inventoryVersion init() built the view for.
+    std::map<std::string, AtlasSprite> hatTextures; // Atlas sprites for each unlocked hat (by id).
 
     std::vector<sf::Vector2f> hatPositions;         // Screen positions for displaying hats in the rack grid.
 };
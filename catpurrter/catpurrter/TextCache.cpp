@@ -0,0 +1,26 @@
+#include "TextCache.h"
+
+sf::Text& TextCache::get(const std::string& string, const sf::Font& font, unsigned size) {
+    Key key(&font, size, string);
+    auto it = labels.find(key);
+    if (it == labels.end())
+        it = labels.emplace(std::move(key), sf::Text(string, font, size)).first;
+    return it->second;
+}
+
+sf::Text& TextCache::slot(const std::string& name, const std::string& string, const sf::Font& font, unsigned size) {
+    Slot& entry = slots[name];
+    // Each setter only invalidates the layout when the value differs
+    entry.text.setFont(font);
+    entry.text.setCharacterSize(size);
+    if (entry.string != string) {
+        entry.string = string;
+        entry.text.setString(string);
+    }
+    return entry.text;
+}
+
+void TextCache::clear() {
+    labels.clear();
+    slots.clear();
+}
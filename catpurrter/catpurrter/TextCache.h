@@ -0,0 +1,35 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <string>
+#include <tuple>
+
+// TextCache keeps sf::Text objects alive between frames so their glyph geometry and bounds are
+// laid out once instead of on every draw. sf::Text only rebuilds its vertices when the string,
+// font, size, style or outline changes; colour, origin and position are cheap to set each frame.
+// Fixed labels are looked up by (string, font, size). Text that changes (score, coins) lives in a
+// named slot that is re-laid out only when its string actually differs.
+// Returned references stay valid until clear(); callers set colour/origin/position before drawing.
+class TextCache {
+public:
+    // Returns the text for a fixed label, laying it out the first time it's asked for.
+    sf::Text& get(const std::string& string, const sf::Font& font, unsigned size);
+
+    // Returns the text in a named slot, updating its string/font/size only if they changed.
+    sf::Text& slot(const std::string& name, const std::string& string, const sf::Font& font, unsigned size);
+
+    // Drops every cached text.
+    void clear();
+
+private:
+    using Key = std::tuple<const sf::Font*, unsigned, std::string>;
+
+    // A named text and the string it was last laid out with (compared without converting to sf::String).
+    struct Slot {
+        std::string string; // Current string.
+        sf::Text text;      // Laid-out text.
+    };
+
+    std::map<Key, sf::Text> labels;    // Fixed labels by (font, size, string).
+    std::map<std::string, Slot> slots; // Changing text by slot name.
+};
@@ -0,0 +1,230 @@
+#include "Widgets.h"
+
+#include <algorithm>
+
+namespace {
+    bool isUp(sf::Keyboard::Key key) { return key == sf::Keyboard::Up || key == sf::Keyboard::W; }
+    bool isDown(sf::Keyboard::Key key) { return key == sf::Keyboard::Down || key == sf::Keyboard::S; }
+    bool isLeft(sf::Keyboard::Key key) { return key == sf::Keyboard::Left || key == sf::Keyboard::A; }
+    bool isRight(sf::Keyboard::Key key) { return key == sf::Keyboard::Right || key == sf::Keyboard::D; }
+
+    // Puts the text's origin at the centre of its bounds.
+    void centerOrigin(sf::Text& text) {
+        sf::FloatRect bounds = text.getLocalBounds();
+        text.setOrigin(bounds.left + bounds.width / 2.f, bounds.top + bounds.height / 2.f);
+    }
+}
+
+// ---- Popup ----
+
+void Popup::setup(sf::FloatRect area, sf::Color fill, sf::Color outline, float outlineThickness) {
+    panel.setPosition(area.left, area.top);
+    panel.setSize({ area.width, area.height });
+    panel.setFillColor(fill);
+    panel.setOutlineColor(outline);
+    panel.setOutlineThickness(outlineThickness);
+    labels.clear();
+}
+
+std::size_t Popup::addLabel(const sf::Font& font, const std::string& string, unsigned size, sf::Color color,
+    sf::Vector2f position, LabelAnchor anchor) {
+    Label label;
+    label.string = string;
+    label.text = sf::Text(string, font, size);
+    label.text.setFillColor(color);
+    label.position = position;
+    label.anchor = anchor;
+    place(label);
+    labels.push_back(label);
+    return labels.size() - 1;
+}
+
+void Popup::setLabel(std::size_t index, const std::string& string) {
+    if (index >= labels.size() || labels[index].string == string)
+        return;
+    labels[index].string = string;
+    labels[index].text.setString(string);
+    place(labels[index]);
+}
+
+void Popup::setLabelVisible(std::size_t index, bool visible) {
+    if (index < labels.size())
+        labels[index].visible = visible;
+}
+
+sf::FloatRect Popup::getLabelBounds(std::size_t index) const {
+    return index < labels.size() ? labels[index].text.getGlobalBounds() : sf::FloatRect();
+}
+
+void Popup::place(Label& label) {
+    sf::FloatRect bounds = label.text.getLocalBounds();
+    switch (label.anchor) {
+    case LabelAnchor::TopLeft:
+        label.text.setOrigin(0.f, 0.f);
+        break;
+    case LabelAnchor::TopCenter:
+        label.text.setOrigin(bounds.left + bounds.width / 2.f, 0.f);
+        break;
+    case LabelAnchor::Center:
+        label.text.setOrigin(bounds.left + bounds.width / 2.f, bounds.top + bounds.height / 2.f);
+        break;
+    }
+    label.text.setPosition(label.position);
+}
+
+void Popup::render(DrawList& target) const {
+    target.draw(panel);
+    for (const Label& label : labels) {
+        if (label.visible)
+            target.draw(label.text);
+    }
+}
+
+// ---- OptionList ----
+
+void OptionList::setSelected(int index) {
+    if (options.empty()) {
+        selected = 0;
+        return;
+    }
+    index = std::clamp(index, 0, static_cast<int>(options.size()) - 1);
+    if (selected >= 0 && selected < static_cast<int>(options.size()))
+        options[selected].setFillColor(normalColor);
+    selected = index;
+    options[selected].setFillColor(selectedColor);
+}
+
+bool OptionList::move(int delta) {
+    int previous = selected;
+    setSelected(selected + delta);
+    return selected != previous;
+}
+
+void OptionList::setOptions(const sf::Font& font, const std::vector<std::string>& labels, unsigned size) {
+    options.resize(labels.size());
+    strings.resize(labels.size());
+    for (std::size_t i = 0; i < labels.size(); ++i) {
+        options[i].setFont(font);
+        options[i].setCharacterSize(size);
+        if (strings[i] != labels[i]) {
+            strings[i] = labels[i];
+            options[i].setString(labels[i]);
+        }
+        options[i].setFillColor(static_cast<int>(i) == selected ? selectedColor : normalColor);
+    }
+    if (selected >= static_cast<int>(options.size()))
+        setSelected(static_cast<int>(options.size()) - 1);
+}
+
+void OptionList::render(DrawList& target) const {
+    for (const auto& option : options)
+        target.draw(option);
+}
+
+// ---- VerticalMenu ----
+
+void VerticalMenu::setup(const sf::Font& font, const std::string& titleString, const std::vector<std::string>& labels,
+    sf::Vector2f center, const Style& style) {
+    normalColor = style.normalColor;
+    selectedColor = style.selectedColor;
+    title = sf::Text(titleString, font, style.titleSize);
+    title.setFillColor(style.titleColor);
+    setOptions(font, labels, style.optionSize);
+
+    // The title and options form one block centred vertically on center
+    sf::FloatRect titleBounds = title.getLocalBounds();
+    float totalHeight = titleBounds.height + style.titleGap;
+    for (std::size_t i = 0; i < options.size(); ++i) {
+        totalHeight += options[i].getLocalBounds().height;
+        if (i > 0) totalHeight += style.optionSpacing;
+    }
+
+    float y = center.y - totalHeight / 2.f;
+    centerOrigin(title);
+    title.setPosition(center.x, y + titleBounds.height / 2.f);
+
+    y += titleBounds.height + style.titleGap;
+    for (auto& option : options) {
+        float height = option.getLocalBounds().height;
+        centerOrigin(option);
+        option.setPosition(center.x, y + height / 2.f);
+        y += height + style.optionSpacing;
+    }
+}
+
+bool VerticalMenu::handleKey(sf::Keyboard::Key key) {
+    if (isUp(key)) move(-1);
+    else if (isDown(key)) move(1);
+    return key == sf::Keyboard::Enter && !options.empty();
+}
+
+void VerticalMenu::render(DrawList& target) const {
+    target.draw(title);
+    OptionList::render(target);
+}
+
+// ---- ChoiceBar ----
+
+void ChoiceBar::setup(const sf::Font& font, const std::vector<std::string>& labels, sf::Vector2f center, const Style& style) {
+    normalColor = style.normalColor;
+    selectedColor = style.selectedColor;
+    setOptions(font, labels, style.size);
+    if (options.empty())
+        return;
+
+    // Either fixed distances between centres, or the options packed side by side with a gap
+    const float count = static_cast<float>(options.size());
+    float x;
+    if (style.cellWidth > 0.f) {
+        x = center.x - style.cellWidth * (count - 1.f) / 2.f;
+    }
+    else {
+        float totalWidth = style.gap * (count - 1.f);
+        for (const auto& option : options)
+            totalWidth += option.getLocalBounds().width;
+        x = center.x - totalWidth / 2.f + options.front().getLocalBounds().width / 2.f;
+    }
+
+    for (std::size_t i = 0; i < options.size(); ++i) {
+        centerOrigin(options[i]);
+        options[i].setPosition(x, center.y);
+        if (i + 1 < options.size()) {
+            x += style.cellWidth > 0.f ? style.cellWidth
+                : options[i].getLocalBounds().width / 2.f + style.gap + options[i + 1].getLocalBounds().width / 2.f;
+        }
+    }
+}
+
+bool ChoiceBar::handleKey(sf::Keyboard::Key key) {
+    if (isLeft(key)) move(-1);
+    else if (isRight(key)) move(1);
+    return key == sf::Keyboard::Enter && !options.empty();
+}
+
+// ---- ListView ----
+
+void ListView::setup(const sf::Font& fontRef, unsigned size, sf::Vector2f position, float height,
+    sf::Color normal, sf::Color highlighted) {
+    font = &fontRef;
+    characterSize = size;
+    origin = position;
+    rowHeight = height;
+    normalColor = normal;
+    selectedColor = highlighted;
+    options.clear();
+    strings.clear();
+}
+
+void ListView::setItems(const std::vector<std::string>& labels) {
+    if (!font)
+        return;
+    setOptions(*font, labels, characterSize);
+    for (std::size_t i = 0; i < options.size(); ++i)
+        options[i].setPosition(origin.x, origin.y + rowHeight * static_cast<float>(i));
+}
+
+bool ListView::handleKey(sf::Keyboard::Key key) {
+    if (isUp(key)) move(-1);
+    else if (isDown(key)) move(1);
+    return key == sf::Keyboard::Enter && !options.empty();
+}
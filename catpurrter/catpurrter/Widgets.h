@@ -0,0 +1,156 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "DrawList.h"
+#include <string>
+#include <vector>
+
+// Small retained-mode widgets for the menus and popups of the minigames and shops.
+// A widget is described once (labels, sizes, colours, where it goes) and lays its text out at setup;
+// after that only input or a changed label touches it, so drawing one is just drawing its texts.
+// Navigation keys are the same everywhere: W/S or Up/Down for lists, A/D or Left/Right for bars,
+// Enter activates. Escape is left to the owner, since what it means differs per screen.
+
+// How a label is placed relative to its position.
+enum class LabelAnchor {
+    TopLeft,   // Position is the top-left corner of the text.
+    TopCenter, // Position is the middle of the text's top edge.
+    Center     // Position is the centre of the text's bounds.
+};
+
+// Popup is a filled panel with labels on it (titles, messages, a multi-line help text...).
+class Popup {
+public:
+    // Sets the panel's area and colours (outlineThickness 0 = no outline) and removes all labels.
+    void setup(sf::FloatRect area, sf::Color fill, sf::Color outline = sf::Color::Transparent, float outlineThickness = 0.f);
+
+    // Adds a label and returns its index for setLabel/setLabelVisible.
+    std::size_t addLabel(const sf::Font& font, const std::string& string, unsigned size, sf::Color color,
+        sf::Vector2f position, LabelAnchor anchor = LabelAnchor::Center);
+
+    // Changes a label's string (re-laid out only if it differs).
+    void setLabel(std::size_t index, const std::string& string);
+
+    // Shows or hides a label.
+    void setLabelVisible(std::size_t index, bool visible);
+
+    // Returns a label's bounds on screen (for placing things relative to it).
+    sf::FloatRect getLabelBounds(std::size_t index) const;
+
+    // Returns the panel's area.
+    sf::FloatRect getArea() const { return panel.getGlobalBounds(); }
+
+    // Draws the panel and its visible labels.
+    void render(DrawList& target) const;
+
+private:
+    // A text placed on the panel.
+    struct Label {
+        std::string string;       // Current string (compared before re-laying out).
+        sf::Text text;            // Laid-out text.
+        sf::Vector2f position;    // Where the anchor point goes.
+        LabelAnchor anchor = LabelAnchor::Center; // Which point of the text sits at position.
+        bool visible = true;      // Hidden labels aren't drawn.
+    };
+
+    // Recomputes a label's origin from its bounds and anchor.
+    static void place(Label& label);
+
+    sf::RectangleShape panel; // Background panel.
+    std::vector<Label> labels; // Labels in drawing order.
+};
+
+// OptionList is the part the menus share: a row of option texts, which one is selected and the two colours.
+class OptionList {
+public:
+    // Returns the selected option's index.
+    int getSelected() const { return selected; }
+
+    // Selects an option (clamped to the list), recolouring only the two options involved.
+    void setSelected(int index);
+
+    // Returns the number of options.
+    std::size_t size() const { return options.size(); }
+
+    // Draws the options.
+    void render(DrawList& target) const;
+
+protected:
+    // Replaces the options' texts (keeping the selection if it's still in range).
+    void setOptions(const sf::Font& font, const std::vector<std::string>& labels, unsigned size);
+
+    // Moves the selection by delta; returns true if it changed.
+    bool move(int delta);
+
+    std::vector<sf::Text> options;                     // Option texts (positioned by the widget).
+    std::vector<std::string> strings;                  // Option strings (compared before re-laying out).
+    int selected = 0;                                  // Highlighted option.
+    sf::Color normalColor = sf::Color::White;          // Colour of the other options.
+    sf::Color selectedColor = sf::Color::Yellow;       // Colour of the highlighted option.
+};
+
+// VerticalMenu is a title with options under it, the block centred on a point (minigame main menus).
+class VerticalMenu : public OptionList {
+public:
+    // Look of the menu.
+    struct Style {
+        unsigned titleSize = 48;                          // Title character size.
+        unsigned optionSize = 32;                         // Option character size.
+        float optionSpacing = 14.f;                       // Gap between options.
+        float titleGap = 28.f;                            // Gap between the title and the first option.
+        sf::Color titleColor = sf::Color::Cyan;           // Title colour.
+        sf::Color normalColor = sf::Color(200, 160, 255); // Unselected options.
+        sf::Color selectedColor = sf::Color(255, 255, 40); // Selected option.
+    };
+
+    // Lays out the title and options around center.
+    void setup(const sf::Font& font, const std::string& title, const std::vector<std::string>& labels,
+        sf::Vector2f center, const Style& style);
+
+    // Moves the selection with W/S or Up/Down; returns true when Enter activates the selected option.
+    bool handleKey(sf::Keyboard::Key key);
+
+    // Draws the title and options.
+    void render(DrawList& target) const;
+
+private:
+    sf::Text title; // Menu title.
+};
+
+// ChoiceBar is a horizontal row of choices (Resume/Exit, Restart/Back to Menu).
+class ChoiceBar : public OptionList {
+public:
+    // Look of the bar.
+    struct Style {
+        unsigned size = 28;                                // Character size.
+        float gap = 50.f;                                  // Gap between packed options.
+        float cellWidth = 0.f;                             // Distance between option centres; 0 packs them with gap instead.
+        sf::Color normalColor = sf::Color::White;          // Unselected options.
+        sf::Color selectedColor = sf::Color(200, 170, 40); // Selected option.
+    };
+
+    // Lays out the options centred on center.
+    void setup(const sf::Font& font, const std::vector<std::string>& labels, sf::Vector2f center, const Style& style);
+
+    // Moves the selection with A/D or Left/Right; returns true when Enter activates the selected option.
+    bool handleKey(sf::Keyboard::Key key);
+};
+
+// ListView is a left-aligned column of rows (shop items, category lists) whose labels can change.
+class ListView : public OptionList {
+public:
+    // Places the list: first row at position, one row every rowHeight pixels.
+    void setup(const sf::Font& font, unsigned size, sf::Vector2f position, float rowHeight,
+        sf::Color normal = sf::Color::White, sf::Color highlighted = sf::Color::Yellow);
+
+    // Sets the rows' labels; only rows whose label changed are laid out again.
+    void setItems(const std::vector<std::string>& labels);
+
+    // Moves the selection with W/S or Up/Down; returns true when Enter activates the selected row.
+    bool handleKey(sf::Keyboard::Key key);
+
+private:
+    const sf::Font* font = nullptr; // Font of the rows.
+    unsigned characterSize = 28;    // Row character size.
+    sf::Vector2f origin;            // Position of the first row.
+    float rowHeight = 50.f;         // Distance between rows.
+};
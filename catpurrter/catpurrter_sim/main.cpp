@@ -0,0 +1,96 @@
+#include "SnakeSim.h"
+#include "CatchSim.h"
+#include "DodgeSim.h"
+#include "RoomSim.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+// catpurrter_sim runs the game rules with no window, as fast as the CPU allows (balance sweeps,
+// regression checks on build machines without a display):
+//   catpurrter_sim <snake|catch|dodge|room> [ticks] [seed]
+// A bot holds a random direction key for a few steps at a time; a round that ends starts again with the
+// next seed. The same arguments always play the same rounds, so the totals can be compared between builds.
+
+namespace {
+    // Same step as the game loop.
+    const float SIM_STEP = 1.f / 120.f;
+
+    // Direction keys the bot picks from (one per move action).
+    const sf::Keyboard::Key BOT_KEYS[] = { sf::Keyboard::Left, sf::Keyboard::Right, sf::Keyboard::Up, sf::Keyboard::Down };
+
+    // Returns the simulation for a name, or nullptr if there's none.
+    std::unique_ptr<Simulation> makeSimulation(const std::string& name) {
+        if (name == "snake") return std::make_unique<SnakeSim>();
+        if (name == "catch") return std::make_unique<CatchSim>();
+        if (name == "dodge") return std::make_unique<DodgeSim>();
+        if (name == "room") {
+            // Every fish, at the fallback sprite size
+            auto room = std::make_unique<RoomSim>();
+            room->setFish({ { "fish1", { 33.f, 21.f } }, { "fish2", { 33.f, 21.f } }, { "fish3", { 33.f, 21.f } } });
+            return room;
+        }
+        return nullptr;
+    }
+
+    void printUsage() {
+        std::cout << "usage: catpurrter_sim <snake|catch|dodge|room> [ticks] [seed]\n";
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        printUsage();
+        return 1;
+    }
+
+    std::unique_ptr<Simulation> sim = makeSimulation(argv[1]);
+    if (!sim) {
+        printUsage();
+        return 1;
+    }
+    const unsigned long long ticks = argc >= 3 ? std::stoull(argv[2]) : 1000000ULL;
+    unsigned seed = argc >= 4 ? static_cast<unsigned>(std::stoul(argv[3])) : 1u;
+
+    std::mt19937 bot(seed);
+    InputState input;
+    unsigned long long rounds = 0;
+    long long totalScore = 0;
+    int holdSteps = 0;
+
+    sim->reset(seed);
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned long long tick = 0; tick < ticks; ++tick) {
+        input.beginStep();
+        // Now and then let go and hold another direction (or nothing)
+        if (--holdSteps <= 0) {
+            input.releaseAll();
+            const unsigned choice = bot() % 5;
+            if (choice < 4)
+                input.press(BOT_KEYS[choice]);
+            holdSteps = 5 + static_cast<int>(bot() % 60);
+        }
+
+        sim->step(SIM_STEP, input);
+        if (sim->isOver()) {
+            ++rounds;
+            totalScore += sim->getScore();
+            sim->reset(++seed);
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // The room never ends: count the one round that ran
+    if (rounds == 0) {
+        rounds = 1;
+        totalScore = sim->getScore();
+    }
+
+    std::cout << argv[1] << ": " << ticks << " ticks (" << ticks * SIM_STEP / 60.f << " game minutes) in "
+        << seconds << " s, " << static_cast<unsigned long long>(ticks / (seconds > 0.0 ? seconds : 1e-9)) << " ticks/s\n"
+        << rounds << " round(s), mean score " << static_cast<double>(totalScore) / static_cast<double>(rounds) << "\n";
+    return 0;
+}